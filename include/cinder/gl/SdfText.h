@@ -36,6 +36,8 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "cinder/gl/GlslProg.h"
 #include "cinder/gl/Texture.h"
 
+#include <array>
+#include <functional>
 #include <unordered_map>
 
 typedef struct FT_FaceRec_*  FT_Face;
@@ -51,6 +53,8 @@ using SdfTextRef = std::shared_ptr<SdfText>;
 class SdfText {
 public:
 	typedef enum Alignment { LEFT, CENTER, RIGHT } Alignment;
+	//! How glyph tiles are laid out on the atlas textures. GRID gives every glyph a cell the size of the largest one, SKYLINE packs tiles sized to each glyph
+	typedef enum Packing { GRID, SKYLINE } Packing;
 
 	//! \class Options
 	//!
@@ -87,6 +91,41 @@ public:
 		Format&			sdfTileSpacing( const ivec2& value ) { mSdfTileSpacing = value; return *this; }
 		const ivec2&	getSdfTileSpacing() const { return mSdfTileSpacing; }
 
+		//! Sets the number of threads used to generate the glyph SDFs. \c 0 uses one thread per hardware core. Default \c 0
+		Format&			bakeThreadCount( int value ) { mBakeThreadCount = value; return *this; }
+		//! Returns the number of threads used to generate the glyph SDFs. \c 0 uses one thread per hardware core. Default \c 0
+		int				getBakeThreadCount() const { return mBakeThreadCount; }
+
+		//! Sets whether the glyph MSDFs are generated with single precision arithmetic, eight pixels per SIMD batch instead of four. It's slightly faster and rarely changes the 8-bit result, see README.md. Default \c false
+		Format&			singlePrecision( bool value = true ) { mSinglePrecision = value; return *this; }
+		//! Returns whether the glyph MSDFs are generated with single precision arithmetic. Default \c false
+		bool			getSinglePrecision() const { return mSinglePrecision; }
+
+		//! Sets whether exact distances are only computed within half the SDF range of the outline. Farther pixels saturate and are filled by a scanline inside test, which is much cheaper. Default \c false
+		Format&			rangeLimited( bool value = true ) { mRangeLimited = value; return *this; }
+		//! Returns whether exact distances are only computed within half the SDF range of the outline. Default \c false
+		bool			getRangeLimited() const { return mRangeLimited; }
+
+		//! Sets how glyph tiles are laid out on the atlas textures. SKYLINE usually needs a fraction of the textures GRID does. Default \c GRID
+		Format&			packing( Packing value ) { mPacking = value; return *this; }
+		//! Returns how glyph tiles are laid out on the atlas textures. Default \c GRID
+		Packing			getPacking() const { return mPacking; }
+
+		//! Sets whether characters missing from the atlas are added when they're first used, instead of being skipped. New glyphs are packed into free space with SKYLINE packing and new textures are added as needed. Default \c false
+		Format&			dynamic( bool value = true ) { mDynamic = value; return *this; }
+		//! Returns whether characters missing from the atlas are added when they're first used. Default \c false
+		bool			getDynamic() const { return mDynamic; }
+
+		//! Sets whether the glyphs are packed onto textures shared with every other font that has the same texture size and tile spacing. Text in several fonts then draws from the same textures, with fewer texture binds and draw calls. Tiles are packed with SKYLINE. Default \c false
+		Format&			sharedPages( bool value = true ) { mSharedPages = value; return *this; }
+		//! Returns whether the glyphs are packed onto textures shared with other fonts. Default \c false
+		bool			getSharedPages() const { return mSharedPages; }
+
+		//! Sets whether the glyphs are baked as a single-channel pseudo-SDF into R8 textures instead of an MSDF into RGB8 textures. It takes a third of the texture memory and upload bandwidth, at the cost of rounder corners, which suits body text at small sizes. Always generated in double precision. Default \c false
+		Format&			singleChannel( bool value = true ) { mSingleChannel = value; return *this; }
+		//! Returns whether the glyphs are baked as a single-channel pseudo-SDF into R8 textures. Default \c false
+		bool			getSingleChannel() const { return mSingleChannel; }
+
 	private:
 		ivec2			mTextureSize = ivec2( 1024 );
 		vec2			mSdfScale = vec2( 2.0f );
@@ -94,6 +133,13 @@ public:
 		float			mSdfRange = 4.0f;
 		float			mSdfAngle = 3.0f;
 		ivec2			mSdfTileSpacing = ivec2( 1 );
+		int				mBakeThreadCount = 0;
+		bool			mSinglePrecision = false;
+		bool			mRangeLimited = false;
+		Packing			mPacking = GRID;
+		bool			mDynamic = false;
+		bool			mSharedPages = false;
+		bool			mSingleChannel = false;
 	};
 
 	// ---------------------------------------------------------------------------------------------
@@ -231,10 +277,13 @@ public:
 		Glyph					getGlyphChar( char utf8Char ) const;
 		std::vector<Glyph>		getGlyphs( const std::string &utf8Chars ) const;
 
+		//! The face the font's caches are keyed by. Other threads may use it too, FreeType calls on it aren't thread-safe.
 		FT_Face					getFace() const;
 
 		static const std::vector<std::string>&	getNames( bool forceRefresh = false );
 		static SdfText::Font					getDefault();
+		//! Sets the file the system fonts are cataloged in between runs, keyed by the font files and their modification times so that warm starts skip the font scan. An empty path turns the catalog off. Only used on Linux and Android, where enumerating the fonts is slow. Defaults to \c cinder-sdftext/SdfTextFontCatalog.bin in the user's cache directory, \c $XDG_CACHE_HOME or \c ~/.cache, on Linux and to the app's cache directory on Android.
+		static void								setCatalogPath( const fs::path &path );
 
 	private:
 		float					mSize = 0;
@@ -263,12 +312,44 @@ public:
 
 	// ---------------------------------------------------------------------------------------------
 
+	//! \class Future
+	//!
+	//! An SdfText being created by createAsync(). Its glyphs are generated on worker threads, its textures are 
+	//! uploaded on the GL thread once they're done.
+	class Future {
+	public:
+		//! Returns whether the SdfText is ready, uploading its textures if the glyphs have been generated and calling the ready callback the first time. Has to be called on the GL thread.
+		bool				isReady() { return finish( false ); }
+		//! Blocks until the glyphs have been generated, then uploads the textures and returns the SdfText. Has to be called on the GL thread.
+		SdfTextRef			wait() { finish( true ); return mSdfText; }
+		//! Returns the SdfText, or \c nullptr while it isn't ready
+		SdfTextRef			getSdfText() const { return mReady ? mSdfText : SdfTextRef(); }
+
+	private:
+		Future( const SdfTextRef &sdfText, const std::function<void( const SdfTextRef& )> &readyFn ) : mSdfText( sdfText ), mReadyFn( readyFn ) {}
+		friend class SdfText;
+
+		SdfTextRef									mSdfText;
+		std::function<void( const SdfTextRef& )>	mReadyFn;
+		bool										mReady = false;
+
+		bool				finish( bool wait );
+	};
+
+	using FutureRef = std::shared_ptr<Future>;
+
+	// ---------------------------------------------------------------------------------------------
+
 	virtual ~SdfText();
 
 	//! Creates a new SdfTextRef with font \a font, ensuring that glyphs necessary to render \a supportedChars are renderable, and format \a format
 	static SdfTextRef		create( const SdfText::Font &font, const Format &format = Format(), const std::string &utf8Chars = SdfText::defaultChars() );
 	//! Creates a new SdfTextRef with SDFT file at \a fontpath if it exists otherwise uses \a font and then saves SDFT file at \a filepath , ensuring that glyphs necessary to render \a supportedChars are renderable, and format \a format
 	static SdfTextRef		create( const fs::path& filePath, const SdfText::Font &font, const Format &format = Format(), const std::string &utf8Chars = SdfText::defaultChars() );
+	//! Creates a new SdfTextRef like create() without waiting for the glyphs to be generated. The font is read on the calling thread, the glyphs are generated on worker threads and the textures are uploaded by Future::isReady(), Future::wait() or updateAsync(), which then call \a readyFn. May be called from any thread.
+	static FutureRef		createAsync( const SdfText::Font &font, const Format &format = Format(), const std::string &utf8Chars = SdfText::defaultChars(), const std::function<void( const SdfTextRef& )> &readyFn = nullptr );
+	//! Uploads the textures of the SdfTexts from createAsync() whose glyphs have been generated and calls their ready callbacks. Has to be called on the GL thread, once per frame for instance.
+	static void				updateAsync();
 
 	static void				save( const DataTargetRef& target, const SdfTextRef& sdfText );
 	static void				save( const fs::path& filePath, const SdfTextRef& sdfText );
@@ -286,12 +367,12 @@ public:
 	//! Draws the glyphs in \a glyphMeasures clipped by \a clip, with \a offset added to each of the glyph offsets with DrawOptions \a options. \a glyphMeasures is a vector of pairs of glyph indices and offsets for the glyph baselines.
 	void	drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const Rectf &clip, vec2 offset, const DrawOptions &options = DrawOptions(), const std::vector<ColorA8u> &colors = std::vector<ColorA8u>() );
 
-	//! Returns pairs of texture and final texture and vertex coords for drawing using \a glyphMeasures, \a baseline, and \a options.
-	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>>	placeChars( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const vec2 &baseline, const DrawOptions &options = DrawOptions() );
-	//! Returns pairs of texture and final texture and vertex coords for drawing using \a str, \a baseline, and \a options.
-	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>>	placeString( const std::string &str, const vec2 &baseline, const DrawOptions &options = DrawOptions() );
-	//! Returns pairs of texture and final texture and vertex coords for wrapped drawing using \a str, \a fitRect,  \a offset, and \a options.
-	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>>	placeStringWrapped( const std::string &str, const Rectf &fitRect, const vec2 &offset = vec2(), const DrawOptions &options = DrawOptions() );
+	//! Returns pairs of texture and final texture and vertex coords for drawing using \a glyphMeasures, \a baseline, and \a options. If \a bounds isn't null it receives the tight bounds of the glyphs offset by \a baseline, from the same pass.
+	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>>	placeChars( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const vec2 &baseline, const DrawOptions &options = DrawOptions(), Rectf *bounds = nullptr );
+	//! Returns pairs of texture and final texture and vertex coords for drawing using \a str, \a baseline, and \a options. If \a bounds isn't null it receives measureStringBounds() offset by \a baseline, without measuring again.
+	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>>	placeString( const std::string &str, const vec2 &baseline, const DrawOptions &options = DrawOptions(), Rectf *bounds = nullptr );
+	//! Returns pairs of texture and final texture and vertex coords for wrapped drawing using \a str, \a fitRect,  \a offset, and \a options. If \a bounds isn't null it receives measureStringBoundsWrapped() offset by the upper left of \a fitRect and \a offset, without measuring again.
+	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>>	placeStringWrapped( const std::string &str, const Rectf &fitRect, const vec2 &offset = vec2(), const DrawOptions &options = DrawOptions(), Rectf *bounds = nullptr );
 	
 	//! Returns the bounds (as a Rectf) in pixels necessary to render the string \a str with DrawOptions \a options.
 	Rectf	measureStringBounds( const std::string &str, const DrawOptions &options = DrawOptions() ) const;
@@ -301,6 +382,10 @@ public:
 	vec2	measureString( const std::string &str, const DrawOptions &options = DrawOptions() ) const;
 	//! Returns the word-wrapped size in pixels necessary to render the string \a str with DrawOptions \a options.
 	vec2	measureStringWrapped( const std::string &str, const Rectf &fitRect, const DrawOptions &options = DrawOptions() ) const;
+	//! Returns the sizes measureString() returns for each of \a strs. The layouts share their scratch buffers, and with \a numThreads other than \c 1 large batches are split across that many threads, \c 0 uses one per hardware core. Default \c 1
+	std::vector<vec2>	measureStrings( const std::vector<std::string> &strs, const DrawOptions &options = DrawOptions(), int numThreads = 1 ) const;
+	//! Returns the sizes measureStringWrapped() returns for each of \a strs fit inside \a fitRect, batched like measureStrings()
+	std::vector<vec2>	measureStringsWrapped( const std::vector<std::string> &strs, const Rectf &fitRect, const DrawOptions &options = DrawOptions(), int numThreads = 1 ) const;
     
 	//! Returns a vector of glyph/placement pairs representing \a str, suitable for use with drawGlyphs. Useful for caching placement and optimizing batching.
 	std::vector<std::pair<SdfText::Font::Glyph,vec2>>		getGlyphPlacements( const std::string &str, const DrawOptions &options = DrawOptions() ) const;
@@ -328,27 +413,95 @@ public:
 
 	uint32_t				getNumTextures() const;
 	const gl::TextureRef&	getTexture( uint32_t n ) const;
+	//! Returns the fraction of the texture area covered by glyph tiles
+	float					getTextureOccupancy() const;
+
+	//! Sets the texture memory, in bytes, that the cached atlases may take up. Once it's exceeded, the least recently used atlases that no SdfText holds anymore are released, unless all their glyphs are shared with other atlases, and rebuilt if they're needed again. Default \c 128 MB
+	static void				setTextureMemoryBudget( size_t bytes );
+	//! Returns the texture memory, in bytes, that the cached atlases may take up
+	static size_t			getTextureMemoryBudget();
+	//! Returns the texture memory, in bytes, taken up by the cached atlases
+	static size_t			getTextureMemoryUsage();
+
+	//! Sets the number of string layouts kept for drawString(), measureString(), placeString() and getGlyphPlacements() calls that repeat a string with the same layout options, so that labels redrawn every frame aren't laid out again. The least recently used layouts are dropped first. \c 0 disables the cache. Default \c 0
+	void					setLayoutCacheSize( size_t numLayouts );
+	//! Returns the number of string layouts kept for repeated calls. Default \c 0
+	size_t					getLayoutCacheSize() const;
 
 	const SdfText::Font::GlyphMetricsMap&	getGlyphMetrics() const { return mGlyphMetrics; }
 	const SdfText::Font::CharToGlyphMap&	getCharToGlyph() const { return mCharToGlyph; }
 
-	static gl::GlslProgRef	defaultShader();
+	//! Returns the default shader for MSDF atlases, or for single-channel ones if \a singleChannel is \c true
+	static gl::GlslProgRef	defaultShader( bool singleChannel = false );
+	//! Returns whether the glyphs are single-channel SDFs in R8 textures rather than MSDFs in RGB8 textures
+	bool					isSingleChannel() const;
 
 private:
-	SdfText( const SdfText::Font &font, const Format &format, const std::string &utf8Chars, bool generateSdf = true );
+	SdfText( const SdfText::Font &font, const Format &format, const std::string &utf8Chars, bool generateSdf = true, bool bakeAsync = false );
 	friend class SdfTextManager;
+	friend class SdfTextBox;
 
 	class TextureAtlas;
 	using TextureAtlasRef = std::shared_ptr<TextureAtlas>;
+	class LayoutCache;
+	struct PlacedGlyphs;
 
 	SdfText::Font						mFont;
 	Format								mFormat;
 	TextureAtlasRef						mTextureAtlases;
-	SdfText::Font::GlyphMetricsMap		mGlyphMetrics;
-	SdfText::Font::CharToGlyphMap		mCharToGlyph;
-	SdfText::Font::GlyphToCharMap		mGlyphToChar;
+	//! Null unless the layout cache is enabled
+	mutable std::unique_ptr<LayoutCache>	mLayoutCache;
+	//! What the layout and draw loops need to know about a glyph
+	struct GlyphRecord {
+		SdfText::Font::Glyph			mGlyph = 0;
+		//! Last character mapped to the glyph
+		SdfText::Font::Char				mChar = 0;
+		SdfText::Font::GlyphMetrics		mMetrics = {};
+		//! Placement on the atlas, null if the glyph has no outline
+		const SdfText::Font::GlyphInfo	*mGlyphInfo = nullptr;
+		//! Bounds and tile size of a glyph resolved but not baked yet, without a texture
+		SdfText::Font::GlyphInfo		mPendingGlyphInfo = {};
+		bool							mPending = false;
+	};
 
-	Rectf	measureStringImpl( const std::string &str, bool wrapped, const Rectf &fitRect, const DrawOptions &options ) const;
+	// Grow as characters are resolved when the atlas is dynamic
+	mutable SdfText::Font::GlyphMetricsMap		mGlyphMetrics;
+	mutable SdfText::Font::CharToGlyphMap		mCharToGlyph;
+	mutable std::vector<SdfText::Font::Glyph>	mPendingGlyphs;
+	//! Glyph records, indexed by a dense glyph id in the order the glyphs were added
+	mutable std::vector<GlyphRecord>			mGlyphRecords;
+	//! Glyph ids by glyph index
+	mutable std::vector<uint32_t>				mGlyphIds;
+	//! Glyph ids by Latin-1 code point, other characters go through mCharToGlyph
+	mutable std::array<uint32_t, 256>			mLatinGlyphIds;
+	//! Records before this one have looked up their placement on the atlas
+	mutable size_t								mNumPlacedGlyphRecords = 0;
+
+	//! Adds the characters of \a utf8Chars that haven't been seen yet to the maps and queues their glyphs for the atlas. Dynamic atlases only.
+	void	resolveChars( const std::string &utf8Chars ) const;
+	//! Adds the queued glyphs to the atlas
+	void	bakePendingGlyphs();
+
+	//! Returns the id of the record of \a glyph, adding the record if needed
+	uint32_t						addGlyphRecord( SdfText::Font::Glyph glyph ) const;
+	//! Maps \a ch to \a glyph in the char map and the glyph table
+	void							mapChar( SdfText::Font::Char ch, SdfText::Font::Glyph glyph ) const;
+	void							setGlyphMetrics( SdfText::Font::Glyph glyph, const SdfText::Font::GlyphMetrics &metrics ) const;
+	//! Points the records added since the last call at their placements on the atlas
+	void							placeGlyphRecords() const;
+	//! Returns the glyph id of \a ch, or ~0 if it hasn't been resolved
+	uint32_t						findGlyphId( SdfText::Font::Char ch ) const;
+	//! Returns the placement of \a glyph on the atlas, its pending placement if it's waiting to be baked, or null if it has no outline
+	const SdfText::Font::GlyphInfo*	findGlyphInfo( SdfText::Font::Glyph glyph ) const;
+
+	//! Lays out \a str in a box of \a boxSize, SdfTextBox::GROW along an axis grows the box with the text. Goes through the layout cache if it's enabled.
+	SdfText::Font::GlyphMeasuresList	layoutString( const std::string &str, const ivec2 &boxSize, const DrawOptions &options ) const;
+	//! Places \a glyphMeasures relative to the baseline in one pass, grouping the quads by texture and collecting their bounds. With \a boundsOnly only the bounds are collected and the textures aren't touched.
+	void								placeGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const DrawOptions &options, PlacedGlyphs *result, bool boundsOnly = false ) const;
+	//! Draws \a placedGlyphs moved by \a offset, one draw call per texture. With a \a clip the quads and their texture coordinates are cut to it along the axes DrawOptions clips.
+	void								drawPlacedGlyphs( const PlacedGlyphs &placedGlyphs, const vec2 &offset, const Rectf *clip, const DrawOptions &options, const std::vector<ColorA8u> &colors );
+	Rectf								measureStringImpl( const std::string &str, bool wrapped, const Rectf &fitRect, const DrawOptions &options ) const;
+	std::vector<vec2>					measureStringsImpl( const std::vector<std::string> &strs, bool wrapped, const Rectf &fitRect, const DrawOptions &options, int numThreads ) const;
 };
 
 }} // namespace cinder::gl
\ No newline at end of file
@@ -195,7 +195,6 @@ private:
 	struct TextDraw {
 		uint32_t				mFeatures = Feature::TEXT;
 		uint32_t				mDirty = Feature::NONE;
-		TextBatchMap			mTextBatches;
 	};
 
 	using TextDrawRef = std::shared_ptr<TextDraw>;
@@ -206,6 +205,8 @@ private:
 	bool						mDirty = false;
 	RunMap						mRunMaps;
 	TextDrawMap					mTextDrawMaps;
+	//! One batch per texture, fonts on shared atlas pages draw together
+	TextBatchMap				mTextBatches;
 	RunDrawMap					mRunDrawMaps;
 
 	void						updateFeatures( const Run *run );
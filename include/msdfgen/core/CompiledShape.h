@@ -0,0 +1,65 @@
+
+#pragma once
+
+#include <vector>
+#include "Shape.h"
+#include "Scanline.h"
+
+namespace msdfgen {
+
+/// Flat form of a shape for distance field generation, which needs no virtual calls or per-edge allocations.
+/// Control points are stored in one array per segment type, the other edge properties in arrays indexed in contour order.
+/// Edges of segment types other than the built-in ones are referenced and evaluated through their virtual functions, so the shape must outlive the compiled form if it has any.
+class CompiledShape {
+
+public:
+    enum EdgeType {
+        LINEAR,
+        QUADRATIC,
+        CUBIC,
+        OTHER
+    };
+
+    struct Bounds {
+        double l, b, r, t;
+    };
+
+    /// Control points of the linear (2 per edge), quadratic (3 per edge) and cubic (4 per edge) segments.
+    std::vector<Point2> linearPoints, quadraticPoints, cubicPoints;
+    /// The same control points rounded to single precision, read by signedDistancesFloat.
+    std::vector<FloatPoint2> linearFloatPoints, quadraticFloatPoints, cubicFloatPoints;
+    /// Edges of other segment types, owned by the shape.
+    std::vector<const EdgeSegment *> otherSegments;
+    /// Segment type of each edge.
+    std::vector<EdgeType> edgeTypes;
+    /// Index of the first control point of each edge in the array of its type, or of the edge in otherSegments.
+    std::vector<int> edgeOffsets;
+    /// Color of each edge.
+    std::vector<EdgeColor> edgeColors;
+    /// Bounding box of each edge.
+    std::vector<Bounds> edgeBounds;
+    /// Specifies whether the shape uses bottom-to-top (false) or top-to-bottom (true) Y coordinates.
+    bool inverseYAxis;
+
+    CompiledShape();
+    /// Converts the shape. Only the built-in linear, quadratic and cubic segments are flattened, other edges are referenced.
+    explicit CompiledShape(const Shape &shape);
+    /// Number of edges, in the order the shape's contours store them.
+    int edgeCount() const;
+    /// Same as EdgeSegment::signedDistance for the specified edge.
+    SignedDistance signedDistance(int edge, Point2 origin, double &param) const;
+    /// Same as EdgeSegment::signedDistances for the specified edge.
+    void signedDistances(int edge, const Point2 *origins, SignedDistance *distances, double *params) const;
+    /// Same as signedDistancesFloat of the specified edge's segment type, for MSDFGEN_FLOAT_BATCH_SIZE origins.
+    /// Edges of other segment types are evaluated in double precision.
+    void signedDistancesFloat(int edge, const Point2 *origins, SignedDistance *distances, double *params) const;
+    /// Same as EdgeSegment::distanceToPseudoDistance for the specified edge.
+    void distanceToPseudoDistance(int edge, SignedDistance &distance, Point2 origin, double param) const;
+    /// Outputs the intersections of an edge with the horizontal line at y, see EdgeSegment::scanlineIntersections.
+    int scanlineIntersections(int edge, double x[3], int dy[3], double y) const;
+    /// Outputs the intersections of the shape's edges with the horizontal line at y.
+    void scanline(Scanline &line, double y) const;
+
+};
+
+}
@@ -13,6 +13,9 @@ public:
     /// The sequence of edges that make up the contour.
     std::vector<EdgeHolder> edges;
 
+    Contour();
+    /// Copies the contour, allocating its edges in the arena, or on the heap if it is NULL.
+    Contour(const Contour &orig, EdgeArena *arena);
     /// Adds an edge to the contour.
     void addEdge(const EdgeHolder &edge);
 #ifdef MSDFGEN_USE_CPP11
@@ -0,0 +1,43 @@
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace msdfgen {
+
+// Default size of the memory blocks of an EdgeArena in bytes, enough for the edges of most glyphs.
+#define MSDFGEN_EDGE_ARENA_BLOCK_SIZE 16384
+
+/// Memory pool for edge segments, which places the edges of a shape next to each other and frees them all at once.
+/// Create edges in it with new (arena) LinearSegment(...) and wrap them in EdgeHolder(segment, arena), or give it to a Shape, which then allocates all of its edges in it.
+/// The arena must outlive every edge allocated from it, and reset() may only be called once none of them are in use anymore.
+class EdgeArena {
+
+public:
+    explicit EdgeArena(size_t blockSize = MSDFGEN_EDGE_ARENA_BLOCK_SIZE);
+    ~EdgeArena();
+    /// Returns memory for an object of the given size, aligned for any edge segment.
+    void * allocate(size_t size);
+    /// Releases all allocations at once, keeping the memory blocks for reuse.
+    void reset();
+    /// Returns whether ptr points into one of the arena's memory blocks.
+    bool contains(const void *ptr) const;
+
+private:
+    struct Block {
+        char *data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t blockSize;
+    size_t currentBlock;
+    size_t offset;
+
+    EdgeArena(const EdgeArena &);
+    EdgeArena & operator=(const EdgeArena &);
+
+};
+
+}
@@ -0,0 +1,45 @@
+
+#pragma once
+
+#include <vector>
+#include "CompiledShape.h"
+
+namespace msdfgen {
+
+/// Uniform grid over the bounding boxes of a shape's edges, used to skip edges that cannot be the nearest one to a point.
+class EdgeGrid {
+
+public:
+    explicit EdgeGrid(const CompiledShape &shape);
+
+    /// Number of edges in the shape, indexed the same way as in CompiledShape.
+    int edgeCount() const;
+    /// Returns a lower bound of the distance between the point and any point of the edge.
+    double edgeDistanceBound(int index, Point2 p) const;
+
+    /// Grid dimensions in cells.
+    int columns() const;
+    int rows() const;
+    /// Returns the cell that contains the point, clamped to the grid.
+    void cell(Point2 p, int &column, int &row) const;
+    /// Returns the range of indices into cellEdges() listing the edges that overlap the cell.
+    void cellRange(int column, int row, int &begin, int &end) const;
+    /// Edge indices of all cells, in cell order.
+    const std::vector<int> & cellEdges() const;
+    /// Returns a lower bound of the distance between the point and any cell outside the block of cells from (c0, r0) to (c1, r1).
+    double outsideDistanceBound(Point2 p, int c0, int r0, int c1, int r1) const;
+
+private:
+    typedef CompiledShape::Bounds Bounds;
+
+    std::vector<Bounds> edgeBounds;
+    std::vector<int> cellStart;
+    std::vector<int> cellContent;
+    Bounds gridBounds;
+    Vector2 cellSize;
+    double pad;
+    int nColumns, nRows;
+
+};
+
+}
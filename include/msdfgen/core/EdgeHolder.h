@@ -6,14 +6,18 @@
 namespace msdfgen {
 
 /// Container for a single edge of dynamic type.
+/// Edges allocated in an arena are destroyed but not freed with the holder, and copies of them are allocated in the same arena.
+/// Edges of segment types that don't support arenas stay on the heap even when an arena is given, and are deleted with the holder.
 class EdgeHolder {
 
 public:
     EdgeHolder();
-    EdgeHolder(EdgeSegment *segment);
-    EdgeHolder(Point2 p0, Point2 p1, EdgeColor edgeColor = WHITE);
-    EdgeHolder(Point2 p0, Point2 p1, Point2 p2, EdgeColor edgeColor = WHITE);
-    EdgeHolder(Point2 p0, Point2 p1, Point2 p2, Point2 p3, EdgeColor edgeColor = WHITE);
+    EdgeHolder(EdgeSegment *segment, EdgeArena *arena = NULL);
+    EdgeHolder(Point2 p0, Point2 p1, EdgeColor edgeColor = WHITE, EdgeArena *arena = NULL);
+    EdgeHolder(Point2 p0, Point2 p1, Point2 p2, EdgeColor edgeColor = WHITE, EdgeArena *arena = NULL);
+    EdgeHolder(Point2 p0, Point2 p1, Point2 p2, Point2 p3, EdgeColor edgeColor = WHITE, EdgeArena *arena = NULL);
+    /// Copies the edge into another arena, or onto the heap if it is NULL.
+    EdgeHolder(const EdgeHolder &orig, EdgeArena *arena);
     EdgeHolder(const EdgeHolder &orig);
 #ifdef MSDFGEN_USE_CPP11
     EdgeHolder(EdgeHolder &&orig);
@@ -29,9 +33,14 @@ public:
     const EdgeSegment * operator->() const;
     operator EdgeSegment *();
     operator const EdgeSegment *() const;
+    /// Returns the arena the edge is allocated in, NULL if it is on the heap.
+    EdgeArena * arena() const;
 
 private:
     EdgeSegment *edgeSegment;
+    EdgeArena *edgeArena;
+
+    void release();
 
 };
 
@@ -0,0 +1,41 @@
+
+#pragma once
+
+#include <vector>
+
+namespace msdfgen {
+
+/// Represents a horizontal scanline intersecting a shape.
+class Scanline {
+
+public:
+    /// An intersection with the scanline.
+    struct Intersection {
+        /// X coordinate.
+        double x;
+        /// Normalized Y direction of the oriented edge at the point of intersection.
+        int direction;
+    };
+
+    Scanline();
+    /// Populates the intersection list.
+    void setIntersections(const std::vector<Intersection> &intersections);
+#ifdef MSDFGEN_USE_CPP11
+    void setIntersections(std::vector<Intersection> &&intersections);
+#endif
+    /// Returns the sum of the directions of the intersections left of x, i.e. the winding number of the shape at x.
+    /// Queries in increasing or decreasing order of x take constant time.
+    int sumIntersections(double x) const;
+    /// Decides whether the scanline is filled at x under the non-zero fill rule.
+    bool filled(double x) const;
+
+private:
+    std::vector<Intersection> intersections;
+    mutable int lastIndex;
+
+    void preprocess();
+    int moveTo(double x) const;
+
+};
+
+}
@@ -14,8 +14,13 @@ public:
     std::vector<Contour> contours;
     /// Specifies whether the shape uses bottom-to-top (false) or top-to-bottom (true) Y coordinates.
     bool inverseYAxis;
+    /// Arena that new edges of the shape are allocated in, such as those created by loadGlyph and normalize, or NULL for the heap.
+    EdgeArena *arena;
 
     Shape();
+    explicit Shape(EdgeArena *arena);
+    /// Copies the shape, allocating its edges in the arena, or on the heap if it is NULL.
+    Shape(const Shape &orig, EdgeArena *arena);
     /// Adds a contour.
     void addContour(const Contour &contour);
 #ifdef MSDFGEN_USE_CPP11
@@ -63,4 +63,27 @@ struct Vector2 {
 /// A vector may also represent a point, which shall be differentiated semantically using the alias Point2.
 typedef Vector2 Point2;
 
+/// A 2-dimensional vector with single precision, the form in which the single-precision distance kernels read control points.
+/// It only has the operations those kernels need.
+struct FloatVector2 {
+
+    float x, y;
+
+    FloatVector2(float val = 0);
+    FloatVector2(float x, float y);
+    /// Rounds a double-precision vector.
+    explicit FloatVector2(const Vector2 &vector);
+    /// Same as Vector2::normalize.
+    FloatVector2 normalize(bool allowZero = false) const;
+    /// Same as Vector2::getOrthonormal.
+    FloatVector2 getOrthonormal(bool polarity = true, bool allowZero = false) const;
+    FloatVector2 operator+(const FloatVector2 &other) const;
+    FloatVector2 operator-(const FloatVector2 &other) const;
+    /// Dot product of two vectors.
+    friend float dotProduct(const FloatVector2 &a, const FloatVector2 &b);
+
+};
+
+typedef FloatVector2 FloatPoint2;
+
 }
@@ -4,12 +4,18 @@
 #include "Vector2.h"
 #include "SignedDistance.h"
 #include "EdgeColor.h"
+#include "EdgeArena.h"
 
 namespace msdfgen {
 
 // Parameters for iterative search of closest point on a cubic Bezier curve. Increase for higher precision.
 #define MSDFGEN_CUBIC_SEARCH_STARTS 4
 #define MSDFGEN_CUBIC_SEARCH_STEPS 4
+// Number of points processed together by signedDistances and signedDistancesFloat.
+#define MSDFGEN_BATCH_SIZE 4
+#define MSDFGEN_FLOAT_BATCH_SIZE 8
+// Number of line segments approximating an edge in the default EdgeSegment::scanlineIntersections.
+#define MSDFGEN_SCANLINE_STEPS 16
 
 /// An abstract edge segment.
 class EdgeSegment {
@@ -19,16 +25,31 @@ public:
 
     EdgeSegment(EdgeColor edgeColor = WHITE) : color(edgeColor) { }
     virtual ~EdgeSegment() { }
-    /// Creates a copy of the edge segment.
-    virtual EdgeSegment * clone() const = 0;
+    static void * operator new(size_t size);
+    /// Allocates the edge segment in the arena, or on the heap if it is NULL.
+    static void * operator new(size_t size, EdgeArena *arena);
+    static void operator delete(void *ptr);
+    static void operator delete(void *ptr, EdgeArena *arena);
+    /// Creates a copy of the edge segment on the heap. The default calls clone(NULL).
+    virtual EdgeSegment * clone() const;
+    /// Creates a copy of the edge segment, allocated in the arena if there is one. The default calls clone(), which puts the copy on the heap.
+    /// Subclasses override at least one of the two.
+    virtual EdgeSegment * clone(EdgeArena *arena) const;
     /// Returns the point on the edge specified by the parameter (between 0 and 1).
     virtual Point2 point(double param) const = 0;
     /// Returns the direction the edge has at the point specified by the parameter.
     virtual Vector2 direction(double param) const = 0;
     /// Returns the minimum signed distance between origin and the edge.
     virtual SignedDistance signedDistance(Point2 origin, double &param) const = 0;
+    /// Computes signedDistance for MSDFGEN_BATCH_SIZE origins at once.
+    virtual void signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const;
     /// Converts a previously retrieved signed distance from origin to pseudo-distance.
     virtual void distanceToPseudoDistance(SignedDistance &distance, Point2 origin, double param) const;
+    /// Converts a previously retrieved signed distance from origin to pseudo-distance, given the point and direction of the edge at the end param lies beyond.
+    static void distanceToPseudoDistance(SignedDistance &distance, Point2 origin, double param, Point2 endPoint, Vector2 endDirection);
+    /// Outputs the X coordinates of the (at most three) intersections of the edge with the horizontal line at y, and the sign of the edge's Y direction at each of them. Returns how many there are.
+    /// The default intersects a polyline of MSDFGEN_SCANLINE_STEPS segments through the edge's points, the built-in segments solve for the exact intersections.
+    virtual int scanlineIntersections(double x[3], int dy[3], double y) const;
     /// Adjusts the bounding box to fit the edge segment.
     virtual void bounds(double &l, double &b, double &r, double &t) const = 0;
 
@@ -36,8 +57,11 @@ public:
     virtual void moveStartPoint(Point2 to) = 0;
     /// Moves the end point of the edge segment.
     virtual void moveEndPoint(Point2 to) = 0;
-    /// Splits the edge segments into thirds which together represent the original edge.
-    virtual void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const = 0;
+    /// Splits the edge segments into thirds which together represent the original edge. The default calls splitInThirds with a NULL arena.
+    virtual void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const;
+    /// Splits the edge segments into thirds, allocating the parts in the arena if there is one. The default calls the overload without an arena, which puts the parts on the heap.
+    /// Subclasses override at least one of the two.
+    virtual void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const;
 
 };
 
@@ -49,14 +73,27 @@ public:
 
     LinearSegment(Point2 p0, Point2 p1, EdgeColor edgeColor = WHITE);
     LinearSegment * clone() const;
+    LinearSegment * clone(EdgeArena *arena) const;
     Point2 point(double param) const;
     Vector2 direction(double param) const;
     SignedDistance signedDistance(Point2 origin, double &param) const;
+    void signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const;
+    int scanlineIntersections(double x[3], int dy[3], double y) const;
     void bounds(double &l, double &b, double &r, double &t) const;
 
     void moveStartPoint(Point2 to);
     void moveEndPoint(Point2 to);
     void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const;
+    void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const;
+
+    // Non-virtual counterparts operating on the control points p, used by CompiledShape.
+    static Point2 point(const Point2 *p, double param);
+    static Vector2 direction(const Point2 *p, double param);
+    static SignedDistance signedDistance(const Point2 *p, Point2 origin, double &param);
+    static void signedDistances(const Point2 *p, const Point2 *origins, SignedDistance *distances, double *params);
+    /// Single-precision signedDistances for MSDFGEN_FLOAT_BATCH_SIZE origins, from single-precision control points.
+    static void signedDistancesFloat(const FloatPoint2 *p, const Point2 *origins, SignedDistance *distances, double *params);
+    static int scanlineIntersections(const Point2 *p, double x[3], int dy[3], double y);
 
 };
 
@@ -68,14 +105,27 @@ public:
 
     QuadraticSegment(Point2 p0, Point2 p1, Point2 p2, EdgeColor edgeColor = WHITE);
     QuadraticSegment * clone() const;
+    QuadraticSegment * clone(EdgeArena *arena) const;
     Point2 point(double param) const;
     Vector2 direction(double param) const;
     SignedDistance signedDistance(Point2 origin, double &param) const;
+    void signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const;
+    int scanlineIntersections(double x[3], int dy[3], double y) const;
     void bounds(double &l, double &b, double &r, double &t) const;
 
     void moveStartPoint(Point2 to);
     void moveEndPoint(Point2 to);
     void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const;
+    void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const;
+
+    // Non-virtual counterparts operating on the control points p, used by CompiledShape.
+    static Point2 point(const Point2 *p, double param);
+    static Vector2 direction(const Point2 *p, double param);
+    static SignedDistance signedDistance(const Point2 *p, Point2 origin, double &param);
+    static void signedDistances(const Point2 *p, const Point2 *origins, SignedDistance *distances, double *params);
+    /// Single-precision signedDistances for MSDFGEN_FLOAT_BATCH_SIZE origins, from single-precision control points.
+    static void signedDistancesFloat(const FloatPoint2 *p, const Point2 *origins, SignedDistance *distances, double *params);
+    static int scanlineIntersections(const Point2 *p, double x[3], int dy[3], double y);
 
 };
 
@@ -87,14 +137,27 @@ public:
 
     CubicSegment(Point2 p0, Point2 p1, Point2 p2, Point2 p3, EdgeColor edgeColor = WHITE);
     CubicSegment * clone() const;
+    CubicSegment * clone(EdgeArena *arena) const;
     Point2 point(double param) const;
     Vector2 direction(double param) const;
     SignedDistance signedDistance(Point2 origin, double &param) const;
+    void signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const;
+    int scanlineIntersections(double x[3], int dy[3], double y) const;
     void bounds(double &l, double &b, double &r, double &t) const;
 
     void moveStartPoint(Point2 to);
     void moveEndPoint(Point2 to);
     void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const;
+    void splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const;
+
+    // Non-virtual counterparts operating on the control points p, used by CompiledShape.
+    static Point2 point(const Point2 *p, double param);
+    static Vector2 direction(const Point2 *p, double param);
+    static SignedDistance signedDistance(const Point2 *p, Point2 origin, double &param);
+    static void signedDistances(const Point2 *p, const Point2 *origins, SignedDistance *distances, double *params);
+    /// Single-precision signedDistances for MSDFGEN_FLOAT_BATCH_SIZE origins, from single-precision control points.
+    static void signedDistancesFloat(const FloatPoint2 *p, const Point2 *origins, SignedDistance *distances, double *params);
+    static int scanlineIntersections(const Point2 *p, double x[3], int dy[3], double y);
 
 };
 
@@ -0,0 +1,440 @@
+
+#pragma once
+
+#include <cmath>
+
+// Picks the widest available instruction set. Define MSDFGEN_NO_SIMD to force the portable implementation.
+#ifndef MSDFGEN_NO_SIMD
+    #if defined(__AVX__)
+        #define MSDFGEN_SIMD_AVX
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define MSDFGEN_SIMD_SSE2
+        #include <emmintrin.h>
+    #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+        #define MSDFGEN_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+namespace msdfgen {
+
+/*
+ * Batch holds four doubles and BatchMask the result of comparing two batches lane by lane.
+ * Every operation is the corresponding IEEE double operation applied to each lane,
+ * so an expression evaluated on batches produces exactly the values the same expression
+ * produces in scalar code, as long as the compiler doesn't contract either one into fused multiply-adds.
+ * FloatBatch and FloatBatchMask are the single-precision equivalents, with eight lanes in the same register width.
+ */
+
+#if defined(MSDFGEN_SIMD_AVX)
+
+class BatchMask {
+
+public:
+    __m256d v;
+
+    BatchMask() { }
+    explicit BatchMask(__m256d v) : v(v) { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const { return _mm256_movemask_pd(v); }
+    friend BatchMask operator&(BatchMask a, BatchMask b) { return BatchMask(_mm256_and_pd(a.v, b.v)); }
+    friend BatchMask operator|(BatchMask a, BatchMask b) { return BatchMask(_mm256_or_pd(a.v, b.v)); }
+    /// Returns a & !b.
+    friend BatchMask andNot(BatchMask a, BatchMask b) { return BatchMask(_mm256_andnot_pd(b.v, a.v)); }
+
+};
+
+class Batch {
+
+public:
+    typedef double Scalar;
+    typedef BatchMask Mask;
+    enum { SIZE = 4 };
+
+    __m256d v;
+
+    Batch() { }
+    Batch(double value) : v(_mm256_set1_pd(value)) { }
+    explicit Batch(__m256d v) : v(v) { }
+    static Batch load(const double *values) { return Batch(_mm256_loadu_pd(values)); }
+    void store(double *values) const { _mm256_storeu_pd(values, v); }
+    friend Batch operator+(Batch a, Batch b) { return Batch(_mm256_add_pd(a.v, b.v)); }
+    friend Batch operator-(Batch a, Batch b) { return Batch(_mm256_sub_pd(a.v, b.v)); }
+    friend Batch operator*(Batch a, Batch b) { return Batch(_mm256_mul_pd(a.v, b.v)); }
+    friend Batch operator/(Batch a, Batch b) { return Batch(_mm256_div_pd(a.v, b.v)); }
+    friend Batch operator-(Batch a) { return Batch(_mm256_xor_pd(a.v, _mm256_set1_pd(-0.))); }
+    friend Batch sqrt(Batch a) { return Batch(_mm256_sqrt_pd(a.v)); }
+    friend Batch fabs(Batch a) { return Batch(_mm256_andnot_pd(_mm256_set1_pd(-0.), a.v)); }
+    friend BatchMask operator<(Batch a, Batch b) { return BatchMask(_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)); }
+    friend BatchMask operator<=(Batch a, Batch b) { return BatchMask(_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)); }
+    friend BatchMask operator>(Batch a, Batch b) { return BatchMask(_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)); }
+    friend BatchMask operator>=(Batch a, Batch b) { return BatchMask(_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ)); }
+    friend BatchMask operator==(Batch a, Batch b) { return BatchMask(_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend Batch select(BatchMask mask, Batch a, Batch b) { return Batch(_mm256_blendv_pd(b.v, a.v, mask.v)); }
+
+};
+
+class FloatBatchMask {
+
+public:
+    __m256 v;
+
+    FloatBatchMask() { }
+    explicit FloatBatchMask(__m256 v) : v(v) { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const { return _mm256_movemask_ps(v); }
+    friend FloatBatchMask operator&(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(_mm256_and_ps(a.v, b.v)); }
+    friend FloatBatchMask operator|(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(_mm256_or_ps(a.v, b.v)); }
+    /// Returns a & !b.
+    friend FloatBatchMask andNot(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(_mm256_andnot_ps(b.v, a.v)); }
+
+};
+
+class FloatBatch {
+
+public:
+    typedef float Scalar;
+    typedef FloatBatchMask Mask;
+    enum { SIZE = 8 };
+
+    __m256 v;
+
+    FloatBatch() { }
+    FloatBatch(double value) : v(_mm256_set1_ps(float(value))) { }
+    explicit FloatBatch(__m256 v) : v(v) { }
+    static FloatBatch load(const float *values) { return FloatBatch(_mm256_loadu_ps(values)); }
+    void store(float *values) const { _mm256_storeu_ps(values, v); }
+    friend FloatBatch operator+(FloatBatch a, FloatBatch b) { return FloatBatch(_mm256_add_ps(a.v, b.v)); }
+    friend FloatBatch operator-(FloatBatch a, FloatBatch b) { return FloatBatch(_mm256_sub_ps(a.v, b.v)); }
+    friend FloatBatch operator*(FloatBatch a, FloatBatch b) { return FloatBatch(_mm256_mul_ps(a.v, b.v)); }
+    friend FloatBatch operator/(FloatBatch a, FloatBatch b) { return FloatBatch(_mm256_div_ps(a.v, b.v)); }
+    friend FloatBatch operator-(FloatBatch a) { return FloatBatch(_mm256_xor_ps(a.v, _mm256_set1_ps(-0.f))); }
+    friend FloatBatch sqrt(FloatBatch a) { return FloatBatch(_mm256_sqrt_ps(a.v)); }
+    friend FloatBatch fabs(FloatBatch a) { return FloatBatch(_mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v)); }
+    friend FloatBatchMask operator<(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)); }
+    friend FloatBatchMask operator<=(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)); }
+    friend FloatBatchMask operator>(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)); }
+    friend FloatBatchMask operator>=(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)); }
+    friend FloatBatchMask operator==(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend FloatBatch select(FloatBatchMask mask, FloatBatch a, FloatBatch b) { return FloatBatch(_mm256_blendv_ps(b.v, a.v, mask.v)); }
+
+};
+
+#elif defined(MSDFGEN_SIMD_SSE2)
+
+class BatchMask {
+
+public:
+    __m128d lo, hi;
+
+    BatchMask() { }
+    BatchMask(__m128d lo, __m128d hi) : lo(lo), hi(hi) { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const { return _mm_movemask_pd(lo)|_mm_movemask_pd(hi)<<2; }
+    friend BatchMask operator&(BatchMask a, BatchMask b) { return BatchMask(_mm_and_pd(a.lo, b.lo), _mm_and_pd(a.hi, b.hi)); }
+    friend BatchMask operator|(BatchMask a, BatchMask b) { return BatchMask(_mm_or_pd(a.lo, b.lo), _mm_or_pd(a.hi, b.hi)); }
+    /// Returns a & !b.
+    friend BatchMask andNot(BatchMask a, BatchMask b) { return BatchMask(_mm_andnot_pd(b.lo, a.lo), _mm_andnot_pd(b.hi, a.hi)); }
+
+};
+
+class Batch {
+
+public:
+    typedef double Scalar;
+    typedef BatchMask Mask;
+    enum { SIZE = 4 };
+
+    __m128d lo, hi;
+
+    Batch() { }
+    Batch(double value) : lo(_mm_set1_pd(value)), hi(lo) { }
+    Batch(__m128d lo, __m128d hi) : lo(lo), hi(hi) { }
+    static Batch load(const double *values) { return Batch(_mm_loadu_pd(values), _mm_loadu_pd(values+2)); }
+    void store(double *values) const { _mm_storeu_pd(values, lo), _mm_storeu_pd(values+2, hi); }
+    friend Batch operator+(Batch a, Batch b) { return Batch(_mm_add_pd(a.lo, b.lo), _mm_add_pd(a.hi, b.hi)); }
+    friend Batch operator-(Batch a, Batch b) { return Batch(_mm_sub_pd(a.lo, b.lo), _mm_sub_pd(a.hi, b.hi)); }
+    friend Batch operator*(Batch a, Batch b) { return Batch(_mm_mul_pd(a.lo, b.lo), _mm_mul_pd(a.hi, b.hi)); }
+    friend Batch operator/(Batch a, Batch b) { return Batch(_mm_div_pd(a.lo, b.lo), _mm_div_pd(a.hi, b.hi)); }
+    friend Batch operator-(Batch a) { return Batch(_mm_xor_pd(a.lo, _mm_set1_pd(-0.)), _mm_xor_pd(a.hi, _mm_set1_pd(-0.))); }
+    friend Batch sqrt(Batch a) { return Batch(_mm_sqrt_pd(a.lo), _mm_sqrt_pd(a.hi)); }
+    friend Batch fabs(Batch a) { return Batch(_mm_andnot_pd(_mm_set1_pd(-0.), a.lo), _mm_andnot_pd(_mm_set1_pd(-0.), a.hi)); }
+    friend BatchMask operator<(Batch a, Batch b) { return BatchMask(_mm_cmplt_pd(a.lo, b.lo), _mm_cmplt_pd(a.hi, b.hi)); }
+    friend BatchMask operator<=(Batch a, Batch b) { return BatchMask(_mm_cmple_pd(a.lo, b.lo), _mm_cmple_pd(a.hi, b.hi)); }
+    friend BatchMask operator>(Batch a, Batch b) { return BatchMask(_mm_cmpgt_pd(a.lo, b.lo), _mm_cmpgt_pd(a.hi, b.hi)); }
+    friend BatchMask operator>=(Batch a, Batch b) { return BatchMask(_mm_cmpge_pd(a.lo, b.lo), _mm_cmpge_pd(a.hi, b.hi)); }
+    friend BatchMask operator==(Batch a, Batch b) { return BatchMask(_mm_cmpeq_pd(a.lo, b.lo), _mm_cmpeq_pd(a.hi, b.hi)); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend Batch select(BatchMask mask, Batch a, Batch b) {
+        return Batch(_mm_or_pd(_mm_and_pd(mask.lo, a.lo), _mm_andnot_pd(mask.lo, b.lo)), _mm_or_pd(_mm_and_pd(mask.hi, a.hi), _mm_andnot_pd(mask.hi, b.hi)));
+    }
+
+};
+
+class FloatBatchMask {
+
+public:
+    __m128 lo, hi;
+
+    FloatBatchMask() { }
+    FloatBatchMask(__m128 lo, __m128 hi) : lo(lo), hi(hi) { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const { return _mm_movemask_ps(lo)|_mm_movemask_ps(hi)<<4; }
+    friend FloatBatchMask operator&(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(_mm_and_ps(a.lo, b.lo), _mm_and_ps(a.hi, b.hi)); }
+    friend FloatBatchMask operator|(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(_mm_or_ps(a.lo, b.lo), _mm_or_ps(a.hi, b.hi)); }
+    /// Returns a & !b.
+    friend FloatBatchMask andNot(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(_mm_andnot_ps(b.lo, a.lo), _mm_andnot_ps(b.hi, a.hi)); }
+
+};
+
+class FloatBatch {
+
+public:
+    typedef float Scalar;
+    typedef FloatBatchMask Mask;
+    enum { SIZE = 8 };
+
+    __m128 lo, hi;
+
+    FloatBatch() { }
+    FloatBatch(double value) : lo(_mm_set1_ps(float(value))), hi(lo) { }
+    FloatBatch(__m128 lo, __m128 hi) : lo(lo), hi(hi) { }
+    static FloatBatch load(const float *values) { return FloatBatch(_mm_loadu_ps(values), _mm_loadu_ps(values+4)); }
+    void store(float *values) const { _mm_storeu_ps(values, lo), _mm_storeu_ps(values+4, hi); }
+    friend FloatBatch operator+(FloatBatch a, FloatBatch b) { return FloatBatch(_mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi)); }
+    friend FloatBatch operator-(FloatBatch a, FloatBatch b) { return FloatBatch(_mm_sub_ps(a.lo, b.lo), _mm_sub_ps(a.hi, b.hi)); }
+    friend FloatBatch operator*(FloatBatch a, FloatBatch b) { return FloatBatch(_mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi)); }
+    friend FloatBatch operator/(FloatBatch a, FloatBatch b) { return FloatBatch(_mm_div_ps(a.lo, b.lo), _mm_div_ps(a.hi, b.hi)); }
+    friend FloatBatch operator-(FloatBatch a) { return FloatBatch(_mm_xor_ps(a.lo, _mm_set1_ps(-0.f)), _mm_xor_ps(a.hi, _mm_set1_ps(-0.f))); }
+    friend FloatBatch sqrt(FloatBatch a) { return FloatBatch(_mm_sqrt_ps(a.lo), _mm_sqrt_ps(a.hi)); }
+    friend FloatBatch fabs(FloatBatch a) { return FloatBatch(_mm_andnot_ps(_mm_set1_ps(-0.f), a.lo), _mm_andnot_ps(_mm_set1_ps(-0.f), a.hi)); }
+    friend FloatBatchMask operator<(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm_cmplt_ps(a.lo, b.lo), _mm_cmplt_ps(a.hi, b.hi)); }
+    friend FloatBatchMask operator<=(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm_cmple_ps(a.lo, b.lo), _mm_cmple_ps(a.hi, b.hi)); }
+    friend FloatBatchMask operator>(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm_cmpgt_ps(a.lo, b.lo), _mm_cmpgt_ps(a.hi, b.hi)); }
+    friend FloatBatchMask operator>=(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm_cmpge_ps(a.lo, b.lo), _mm_cmpge_ps(a.hi, b.hi)); }
+    friend FloatBatchMask operator==(FloatBatch a, FloatBatch b) { return FloatBatchMask(_mm_cmpeq_ps(a.lo, b.lo), _mm_cmpeq_ps(a.hi, b.hi)); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend FloatBatch select(FloatBatchMask mask, FloatBatch a, FloatBatch b) {
+        return FloatBatch(_mm_or_ps(_mm_and_ps(mask.lo, a.lo), _mm_andnot_ps(mask.lo, b.lo)), _mm_or_ps(_mm_and_ps(mask.hi, a.hi), _mm_andnot_ps(mask.hi, b.hi)));
+    }
+
+};
+
+#elif defined(MSDFGEN_SIMD_NEON)
+
+class BatchMask {
+
+public:
+    uint64x2_t lo, hi;
+
+    BatchMask() { }
+    BatchMask(uint64x2_t lo, uint64x2_t hi) : lo(lo), hi(hi) { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const {
+        return int(vgetq_lane_u64(lo, 0)&1)|int(vgetq_lane_u64(lo, 1)&1)<<1|int(vgetq_lane_u64(hi, 0)&1)<<2|int(vgetq_lane_u64(hi, 1)&1)<<3;
+    }
+    friend BatchMask operator&(BatchMask a, BatchMask b) { return BatchMask(vandq_u64(a.lo, b.lo), vandq_u64(a.hi, b.hi)); }
+    friend BatchMask operator|(BatchMask a, BatchMask b) { return BatchMask(vorrq_u64(a.lo, b.lo), vorrq_u64(a.hi, b.hi)); }
+    /// Returns a & !b.
+    friend BatchMask andNot(BatchMask a, BatchMask b) { return BatchMask(vbicq_u64(a.lo, b.lo), vbicq_u64(a.hi, b.hi)); }
+
+};
+
+class Batch {
+
+public:
+    typedef double Scalar;
+    typedef BatchMask Mask;
+    enum { SIZE = 4 };
+
+    float64x2_t lo, hi;
+
+    Batch() { }
+    Batch(double value) : lo(vdupq_n_f64(value)), hi(lo) { }
+    Batch(float64x2_t lo, float64x2_t hi) : lo(lo), hi(hi) { }
+    static Batch load(const double *values) { return Batch(vld1q_f64(values), vld1q_f64(values+2)); }
+    void store(double *values) const { vst1q_f64(values, lo), vst1q_f64(values+2, hi); }
+    friend Batch operator+(Batch a, Batch b) { return Batch(vaddq_f64(a.lo, b.lo), vaddq_f64(a.hi, b.hi)); }
+    friend Batch operator-(Batch a, Batch b) { return Batch(vsubq_f64(a.lo, b.lo), vsubq_f64(a.hi, b.hi)); }
+    friend Batch operator*(Batch a, Batch b) { return Batch(vmulq_f64(a.lo, b.lo), vmulq_f64(a.hi, b.hi)); }
+    friend Batch operator/(Batch a, Batch b) { return Batch(vdivq_f64(a.lo, b.lo), vdivq_f64(a.hi, b.hi)); }
+    friend Batch operator-(Batch a) { return Batch(vnegq_f64(a.lo), vnegq_f64(a.hi)); }
+    friend Batch sqrt(Batch a) { return Batch(vsqrtq_f64(a.lo), vsqrtq_f64(a.hi)); }
+    friend Batch fabs(Batch a) { return Batch(vabsq_f64(a.lo), vabsq_f64(a.hi)); }
+    friend BatchMask operator<(Batch a, Batch b) { return BatchMask(vcltq_f64(a.lo, b.lo), vcltq_f64(a.hi, b.hi)); }
+    friend BatchMask operator<=(Batch a, Batch b) { return BatchMask(vcleq_f64(a.lo, b.lo), vcleq_f64(a.hi, b.hi)); }
+    friend BatchMask operator>(Batch a, Batch b) { return BatchMask(vcgtq_f64(a.lo, b.lo), vcgtq_f64(a.hi, b.hi)); }
+    friend BatchMask operator>=(Batch a, Batch b) { return BatchMask(vcgeq_f64(a.lo, b.lo), vcgeq_f64(a.hi, b.hi)); }
+    friend BatchMask operator==(Batch a, Batch b) { return BatchMask(vceqq_f64(a.lo, b.lo), vceqq_f64(a.hi, b.hi)); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend Batch select(BatchMask mask, Batch a, Batch b) { return Batch(vbslq_f64(mask.lo, a.lo, b.lo), vbslq_f64(mask.hi, a.hi, b.hi)); }
+
+};
+
+class FloatBatchMask {
+
+public:
+    uint32x4_t lo, hi;
+
+    FloatBatchMask() { }
+    FloatBatchMask(uint32x4_t lo, uint32x4_t hi) : lo(lo), hi(hi) { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const {
+        static const uint32_t weights[4] = { 1, 2, 4, 8 };
+        uint32x4_t w = vld1q_u32(weights);
+        return int(vaddvq_u32(vandq_u32(lo, w)))|int(vaddvq_u32(vandq_u32(hi, w)))<<4;
+    }
+    friend FloatBatchMask operator&(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(vandq_u32(a.lo, b.lo), vandq_u32(a.hi, b.hi)); }
+    friend FloatBatchMask operator|(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(vorrq_u32(a.lo, b.lo), vorrq_u32(a.hi, b.hi)); }
+    /// Returns a & !b.
+    friend FloatBatchMask andNot(FloatBatchMask a, FloatBatchMask b) { return FloatBatchMask(vbicq_u32(a.lo, b.lo), vbicq_u32(a.hi, b.hi)); }
+
+};
+
+class FloatBatch {
+
+public:
+    typedef float Scalar;
+    typedef FloatBatchMask Mask;
+    enum { SIZE = 8 };
+
+    float32x4_t lo, hi;
+
+    FloatBatch() { }
+    FloatBatch(double value) : lo(vdupq_n_f32(float(value))), hi(lo) { }
+    FloatBatch(float32x4_t lo, float32x4_t hi) : lo(lo), hi(hi) { }
+    static FloatBatch load(const float *values) { return FloatBatch(vld1q_f32(values), vld1q_f32(values+4)); }
+    void store(float *values) const { vst1q_f32(values, lo), vst1q_f32(values+4, hi); }
+    friend FloatBatch operator+(FloatBatch a, FloatBatch b) { return FloatBatch(vaddq_f32(a.lo, b.lo), vaddq_f32(a.hi, b.hi)); }
+    friend FloatBatch operator-(FloatBatch a, FloatBatch b) { return FloatBatch(vsubq_f32(a.lo, b.lo), vsubq_f32(a.hi, b.hi)); }
+    friend FloatBatch operator*(FloatBatch a, FloatBatch b) { return FloatBatch(vmulq_f32(a.lo, b.lo), vmulq_f32(a.hi, b.hi)); }
+    friend FloatBatch operator/(FloatBatch a, FloatBatch b) { return FloatBatch(vdivq_f32(a.lo, b.lo), vdivq_f32(a.hi, b.hi)); }
+    friend FloatBatch operator-(FloatBatch a) { return FloatBatch(vnegq_f32(a.lo), vnegq_f32(a.hi)); }
+    friend FloatBatch sqrt(FloatBatch a) { return FloatBatch(vsqrtq_f32(a.lo), vsqrtq_f32(a.hi)); }
+    friend FloatBatch fabs(FloatBatch a) { return FloatBatch(vabsq_f32(a.lo), vabsq_f32(a.hi)); }
+    friend FloatBatchMask operator<(FloatBatch a, FloatBatch b) { return FloatBatchMask(vcltq_f32(a.lo, b.lo), vcltq_f32(a.hi, b.hi)); }
+    friend FloatBatchMask operator<=(FloatBatch a, FloatBatch b) { return FloatBatchMask(vcleq_f32(a.lo, b.lo), vcleq_f32(a.hi, b.hi)); }
+    friend FloatBatchMask operator>(FloatBatch a, FloatBatch b) { return FloatBatchMask(vcgtq_f32(a.lo, b.lo), vcgtq_f32(a.hi, b.hi)); }
+    friend FloatBatchMask operator>=(FloatBatch a, FloatBatch b) { return FloatBatchMask(vcgeq_f32(a.lo, b.lo), vcgeq_f32(a.hi, b.hi)); }
+    friend FloatBatchMask operator==(FloatBatch a, FloatBatch b) { return FloatBatchMask(vceqq_f32(a.lo, b.lo), vceqq_f32(a.hi, b.hi)); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend FloatBatch select(FloatBatchMask mask, FloatBatch a, FloatBatch b) { return FloatBatch(vbslq_f32(mask.lo, a.lo, b.lo), vbslq_f32(mask.hi, a.hi, b.hi)); }
+
+};
+
+#else
+
+class BatchMask {
+
+public:
+    bool v[4];
+
+    BatchMask() { }
+    BatchMask(bool a, bool b, bool c, bool d) { v[0] = a, v[1] = b, v[2] = c, v[3] = d; }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const { return int(v[0])|int(v[1])<<1|int(v[2])<<2|int(v[3])<<3; }
+    friend BatchMask operator&(BatchMask a, BatchMask b) { return BatchMask(a.v[0] && b.v[0], a.v[1] && b.v[1], a.v[2] && b.v[2], a.v[3] && b.v[3]); }
+    friend BatchMask operator|(BatchMask a, BatchMask b) { return BatchMask(a.v[0] || b.v[0], a.v[1] || b.v[1], a.v[2] || b.v[2], a.v[3] || b.v[3]); }
+    /// Returns a & !b.
+    friend BatchMask andNot(BatchMask a, BatchMask b) { return BatchMask(a.v[0] && !b.v[0], a.v[1] && !b.v[1], a.v[2] && !b.v[2], a.v[3] && !b.v[3]); }
+
+};
+
+class Batch {
+
+public:
+    typedef double Scalar;
+    typedef BatchMask Mask;
+    enum { SIZE = 4 };
+
+    double v[4];
+
+    Batch() { }
+    Batch(double value) { v[0] = v[1] = v[2] = v[3] = value; }
+    Batch(double a, double b, double c, double d) { v[0] = a, v[1] = b, v[2] = c, v[3] = d; }
+    static Batch load(const double *values) { return Batch(values[0], values[1], values[2], values[3]); }
+    void store(double *values) const { values[0] = v[0], values[1] = v[1], values[2] = v[2], values[3] = v[3]; }
+    friend Batch operator+(Batch a, Batch b) { return Batch(a.v[0]+b.v[0], a.v[1]+b.v[1], a.v[2]+b.v[2], a.v[3]+b.v[3]); }
+    friend Batch operator-(Batch a, Batch b) { return Batch(a.v[0]-b.v[0], a.v[1]-b.v[1], a.v[2]-b.v[2], a.v[3]-b.v[3]); }
+    friend Batch operator*(Batch a, Batch b) { return Batch(a.v[0]*b.v[0], a.v[1]*b.v[1], a.v[2]*b.v[2], a.v[3]*b.v[3]); }
+    friend Batch operator/(Batch a, Batch b) { return Batch(a.v[0]/b.v[0], a.v[1]/b.v[1], a.v[2]/b.v[2], a.v[3]/b.v[3]); }
+    friend Batch operator-(Batch a) { return Batch(-a.v[0], -a.v[1], -a.v[2], -a.v[3]); }
+    friend Batch sqrt(Batch a) { return Batch(std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])); }
+    friend Batch fabs(Batch a) { return Batch(std::fabs(a.v[0]), std::fabs(a.v[1]), std::fabs(a.v[2]), std::fabs(a.v[3])); }
+    friend BatchMask operator<(Batch a, Batch b) { return BatchMask(a.v[0] < b.v[0], a.v[1] < b.v[1], a.v[2] < b.v[2], a.v[3] < b.v[3]); }
+    friend BatchMask operator<=(Batch a, Batch b) { return BatchMask(a.v[0] <= b.v[0], a.v[1] <= b.v[1], a.v[2] <= b.v[2], a.v[3] <= b.v[3]); }
+    friend BatchMask operator>(Batch a, Batch b) { return BatchMask(a.v[0] > b.v[0], a.v[1] > b.v[1], a.v[2] > b.v[2], a.v[3] > b.v[3]); }
+    friend BatchMask operator>=(Batch a, Batch b) { return BatchMask(a.v[0] >= b.v[0], a.v[1] >= b.v[1], a.v[2] >= b.v[2], a.v[3] >= b.v[3]); }
+    friend BatchMask operator==(Batch a, Batch b) { return BatchMask(a.v[0] == b.v[0], a.v[1] == b.v[1], a.v[2] == b.v[2], a.v[3] == b.v[3]); }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend Batch select(BatchMask mask, Batch a, Batch b) {
+        return Batch(mask.v[0] ? a.v[0] : b.v[0], mask.v[1] ? a.v[1] : b.v[1], mask.v[2] ? a.v[2] : b.v[2], mask.v[3] ? a.v[3] : b.v[3]);
+    }
+
+};
+
+class FloatBatchMask {
+
+public:
+    bool v[8];
+
+    FloatBatchMask() { }
+    /// Returns a bit per lane, lane 0 in the lowest bit.
+    int bits() const {
+        int result = 0;
+        for (int i = 0; i < 8; ++i)
+            result |= int(v[i])<<i;
+        return result;
+    }
+    friend FloatBatchMask operator&(FloatBatchMask a, FloatBatchMask b) { for (int i = 0; i < 8; ++i) a.v[i] = a.v[i] && b.v[i]; return a; }
+    friend FloatBatchMask operator|(FloatBatchMask a, FloatBatchMask b) { for (int i = 0; i < 8; ++i) a.v[i] = a.v[i] || b.v[i]; return a; }
+    /// Returns a & !b.
+    friend FloatBatchMask andNot(FloatBatchMask a, FloatBatchMask b) { for (int i = 0; i < 8; ++i) a.v[i] = a.v[i] && !b.v[i]; return a; }
+
+};
+
+class FloatBatch {
+
+public:
+    typedef float Scalar;
+    typedef FloatBatchMask Mask;
+    enum { SIZE = 8 };
+
+    float v[8];
+
+    FloatBatch() { }
+    FloatBatch(double value) { for (int i = 0; i < 8; ++i) v[i] = float(value); }
+    static FloatBatch load(const float *values) { FloatBatch r; for (int i = 0; i < 8; ++i) r.v[i] = values[i]; return r; }
+    void store(float *values) const { for (int i = 0; i < 8; ++i) values[i] = v[i]; }
+    friend FloatBatch operator+(FloatBatch a, FloatBatch b) { for (int i = 0; i < 8; ++i) a.v[i] += b.v[i]; return a; }
+    friend FloatBatch operator-(FloatBatch a, FloatBatch b) { for (int i = 0; i < 8; ++i) a.v[i] -= b.v[i]; return a; }
+    friend FloatBatch operator*(FloatBatch a, FloatBatch b) { for (int i = 0; i < 8; ++i) a.v[i] *= b.v[i]; return a; }
+    friend FloatBatch operator/(FloatBatch a, FloatBatch b) { for (int i = 0; i < 8; ++i) a.v[i] /= b.v[i]; return a; }
+    friend FloatBatch operator-(FloatBatch a) { for (int i = 0; i < 8; ++i) a.v[i] = -a.v[i]; return a; }
+    friend FloatBatch sqrt(FloatBatch a) { for (int i = 0; i < 8; ++i) a.v[i] = std::sqrt(a.v[i]); return a; }
+    friend FloatBatch fabs(FloatBatch a) { for (int i = 0; i < 8; ++i) a.v[i] = std::fabs(a.v[i]); return a; }
+    friend FloatBatchMask operator<(FloatBatch a, FloatBatch b) { FloatBatchMask r; for (int i = 0; i < 8; ++i) r.v[i] = a.v[i] < b.v[i]; return r; }
+    friend FloatBatchMask operator<=(FloatBatch a, FloatBatch b) { FloatBatchMask r; for (int i = 0; i < 8; ++i) r.v[i] = a.v[i] <= b.v[i]; return r; }
+    friend FloatBatchMask operator>(FloatBatch a, FloatBatch b) { FloatBatchMask r; for (int i = 0; i < 8; ++i) r.v[i] = a.v[i] > b.v[i]; return r; }
+    friend FloatBatchMask operator>=(FloatBatch a, FloatBatch b) { FloatBatchMask r; for (int i = 0; i < 8; ++i) r.v[i] = a.v[i] >= b.v[i]; return r; }
+    friend FloatBatchMask operator==(FloatBatch a, FloatBatch b) { FloatBatchMask r; for (int i = 0; i < 8; ++i) r.v[i] = a.v[i] == b.v[i]; return r; }
+    /// Returns a in the lanes where the mask is set and b elsewhere.
+    friend FloatBatch select(FloatBatchMask mask, FloatBatch a, FloatBatch b) { for (int i = 0; i < 8; ++i) if (!mask.v[i]) a.v[i] = b.v[i]; return a; }
+
+};
+
+#endif
+
+/// Returns 1 in the lanes with positive values and -1 elsewhere, like nonZeroSign.
+inline Batch nonZeroSign(Batch n) {
+    return select(n > Batch(0.), Batch(1.), Batch(-1.));
+}
+
+inline FloatBatch nonZeroSign(FloatBatch n) {
+    return select(n > FloatBatch(0.), FloatBatch(1.), FloatBatch(-1.));
+}
+
+}
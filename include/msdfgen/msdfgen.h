@@ -17,7 +17,10 @@
 
 #include "msdfgen/core/arithmetics.hpp"
 #include "msdfgen/core/Vector2.h"
+#include "msdfgen/core/EdgeArena.h"
 #include "msdfgen/core/Shape.h"
+#include "msdfgen/core/CompiledShape.h"
+#include "msdfgen/core/EdgeGrid.h"
 #include "msdfgen/core/Bitmap.h"
 #include "msdfgen/core/edge-coloring.h"
 #include "msdfgen/core/render-sdf.h"
@@ -28,13 +31,35 @@
 
 namespace msdfgen {
 
+/// Arithmetic precision of the distance computations. Single precision evaluates twice as many pixels per instruction.
+enum Precision {
+    DOUBLE_PRECISION,
+    SINGLE_PRECISION
+};
+
 /// Generates a conventional single-channel signed distance field.
 void generateSDF(Bitmap<float> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate);
+void generateSDF(Bitmap<float> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate);
 
 /// Generates a single-channel signed pseudo-distance field.
 void generatePseudoSDF(Bitmap<float> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate);
+void generatePseudoSDF(Bitmap<float> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate);
+
+/// Generates a single-channel signed pseudo-distance field as 8-bit values, written straight into a strided destination like the 8-bit generateMSDF.
+/// rangeLimited and invert work as they do for generateMSDF. It is always computed in double precision.
+void generatePseudoSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, bool rangeLimited = false, bool invert = false);
+void generatePseudoSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, bool rangeLimited = false, bool invert = false);
 
 /// Generates a multi-channel signed distance field. Edge colors must be assigned first! (see edgeColoringSimple)
-void generateMSDF(Bitmap<FloatRGB> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold = 1.00000001);
+/// If rangeLimited is set, exact distances are only computed within half the range of an edge, where the output is not saturated.
+/// The remaining pixels are set to 0 or 1 by a non-zero winding test along their row.
+void generateMSDF(Bitmap<FloatRGB> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold = 1.00000001, Precision precision = DOUBLE_PRECISION, bool rangeLimited = false);
+void generateMSDF(Bitmap<FloatRGB> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold = 1.00000001, Precision precision = DOUBLE_PRECISION, bool rangeLimited = false);
+
+/// Generates a multi-channel signed distance field as 8-bit RGB, written straight into a strided destination such as a tile of a larger image.
+/// The red, green and blue bytes of pixel (x, y) are stored at output+y*rowStride+x*pixelStride, with rows in the same order as in a Bitmap.
+/// If invert is set, the sign of the distances is flipped, which swaps the inside and the outside of the shape.
+void generateMSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold = 1.00000001, Precision precision = DOUBLE_PRECISION, bool rangeLimited = false, bool invert = false);
+void generateMSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold = 1.00000001, Precision precision = DOUBLE_PRECISION, bool rangeLimited = false, bool invert = false);
 
 }
@@ -19,6 +19,10 @@ if( NOT TARGET Cinder-SdfText )
 			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/shape-description.cpp"
 			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/SignedDistance.cpp"
 			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/Vector2.cpp"
+			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/EdgeGrid.cpp"
+			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/CompiledShape.cpp"
+			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/Scanline.cpp"
+			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/core/EdgeArena.cpp"
 			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/msdfgen.cpp"
 			"${CINDER_SDFTEXT_SOURCE_PATH}/msdfgen/util.cpp"
 		)
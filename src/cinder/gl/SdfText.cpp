@@ -58,14 +58,27 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "ft2build.h"
 #include FT_FREETYPE_H
+#include "freetype/ftsizes.h"
 #include "freetype/ftsnames.h"
 #include "freetype/ttnameid.h"
 
 #include "msdfgen/msdfgen.h"
 #include "msdfgen/util.h"
 
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <future>
+#include <list>
+#include <map>
+#include <mutex>
 #include <set>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <boost/algorithm/string.hpp>
 
@@ -75,7 +88,15 @@ POSSIBILITY OF SUCH DAMAGE.
 	#include <Windows.h>
 #endif
 
+#if ! defined( CINDER_MSW ) && ! defined( CINDER_WINRT )
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 static const float MAX_SIZE = 1000000.0f;
+static const uint32_t INVALID_GLYPH_ID = ~0u;
 
 namespace cinder { namespace gl {
 
@@ -115,14 +136,22 @@ static std::string kSdfFragShader =
 	"   return v * len;\n"
 	"}\n"
 	"\n"
+	"float sampleDistance( vec2 uv ) {\n"
+	"#if defined( SINGLE_CHANNEL )\n"
+	"	return texture2D( uTex0, uv ).r;\n"
+	"#else\n"
+	"	vec3 sample = texture2D( uTex0, uv ).rgb;\n"
+	"	return median( sample.r, sample.g, sample.b );\n"
+	"#endif\n"
+	"}\n"
+	"\n"
   #if defined( CINDER_LINUX_EGL_ONLY )
 	"float calcDiff( vec2 p ) {\n"
 	"   return p.x * p.x - p.y;\n"
 	"}\n"
 	"\n"	
 	"void main(void) {\n"
-	"    vec3 sample = texture2D( uTex0, TexCoord ).rgb;\n"
-	"    float sigDist = median( sample.r, sample.g, sample.b );\n"
+	"    float sigDist = sampleDistance( TexCoord );\n"
 	"    float c = calcDiff( TexCoord );\n"
 	"    vec2 ps = vec2( 1.0 / uTexSize.x, 1.0 / uTexSize.y );\n"
 	"    float dfdx = calcDiff( TexCoord + vec2( ps.x ) ) - c;\n"
@@ -136,10 +165,8 @@ static std::string kSdfFragShader =
 	"    // Calculate derivates\n"
 	"    vec2 Jdx = dFdx( uv );\n"
 	"    vec2 Jdy = dFdy( uv );\n"
-	"    // Sample SDF texture (3 channels).\n"
-	"    vec3 sample = texture2D( uTex0, TexCoord ).rgb;\n"
-	"    // Calculate signed distance (in texels).\n"
-	"    float sigDist = median( sample.r, sample.g, sample.b ) - 0.5;\n"
+	"    // Sample SDF texture (1 or 3 channels) and calculate signed distance (in texels).\n"
+	"    float sigDist = sampleDistance( TexCoord ) - 0.5;\n"
 	"    // For proper anti-aliasing, we need to calculate signed distance in pixels. We do this using derivatives.\n"
 	"    vec2 gradDist = safeNormalize( vec2( dFdx( sigDist ), dFdy( sigDist ) ) );\n"
 	"    vec2 grad = vec2( gradDist.x * Jdx.x + gradDist.y * Jdy.x, gradDist.x * Jdx.y + gradDist.y * Jdy.y );\n"
@@ -187,16 +214,23 @@ static std::string kSdfFragShader =
 	"   return v * len;\n"
 	"}\n"
 	"\n"
+	"float sampleDistance( vec2 uv ) {\n"
+	"#if defined( SINGLE_CHANNEL )\n"
+	"	return texture( uTex0, uv ).r;\n"
+	"#else\n"
+	"	vec3 sample = texture( uTex0, uv ).rgb;\n"
+	"	return median( sample.r, sample.g, sample.b );\n"
+	"#endif\n"
+	"}\n"
+	"\n"
 	"void main(void) {\n"
 	"    // Convert normalized texcoords to absolute texcoords.\n"
 	"    vec2 uv = TexCoord * textureSize( uTex0, 0 );\n"
 	"    // Calculate derivates\n"
 	"    vec2 Jdx = dFdx( uv );\n"
 	"    vec2 Jdy = dFdy( uv );\n"
-	"    // Sample SDF texture (3 channels).\n"
-	"    vec3 sample = texture( uTex0, TexCoord ).rgb;\n"
-	"    // Calculate signed distance (in texels).\n"
-	"    float sigDist = median( sample.r, sample.g, sample.b ) - 0.5;\n"
+	"    // Sample SDF texture (1 or 3 channels) and calculate signed distance (in texels).\n"
+	"    float sigDist = sampleDistance( TexCoord ) - 0.5;\n"
 	"    // For proper anti-aliasing, we need to calculate signed distance in pixels. We do this using derivatives.\n"
 	"    vec2 gradDist = safeNormalize( vec2( dFdx( sigDist ), dFdy( sigDist ) ) );\n"
 	"    vec2 grad = vec2( gradDist.x * Jdx.x + gradDist.y * Jdy.x, gradDist.x * Jdx.y + gradDist.y * Jdy.y );\n"
@@ -213,6 +247,379 @@ static std::string kSdfFragShader =
 #endif
 
 static gl::GlslProgRef sDefaultShader;
+static gl::GlslProgRef sDefaultSingleChannelShader;
+
+//! 64-bit FNV-1a, continuing from \a hash
+static uint64_t hashBytes( const void *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL )
+{
+	const unsigned char *bytes = static_cast<const unsigned char *>( data );
+	for( size_t i = 0; i < size; ++i ) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+static uint32_t readBigEndian32( const uint8_t *data )
+{
+	return ( static_cast<uint32_t>( data[0] ) << 24 ) | ( static_cast<uint32_t>( data[1] ) << 16 ) | ( static_cast<uint32_t>( data[2] ) << 8 ) | static_cast<uint32_t>( data[3] );
+}
+
+//! Digest of an sfnt font file (TrueType, OpenType or a collection of them) that only reads its first page or so: the 
+//! file size and the table directory of face \a faceIndex, whose records carry a checksum of every table. Returns 
+//! false if \a data isn't an sfnt.
+static bool hashSfntDirectory( const uint8_t *data, size_t size, FT_Long faceIndex, uint64_t *hash )
+{
+	uint64_t sizeValue = static_cast<uint64_t>( size );
+	*hash = hashBytes( &sizeValue, sizeof( sizeValue ), *hash );
+
+	// Collections list the offsets of the directories of their faces
+	size_t dirOffset = 0;
+	if( ( size >= 12 ) && ( 0 == std::memcmp( data, "ttcf", 4 ) ) ) {
+		const size_t index = static_cast<size_t>( faceIndex & 0xFFFF );
+		if( ( index >= readBigEndian32( data + 8 ) ) || ( size < 12 + 4 * ( index + 1 ) ) ) {
+			return false;
+		}
+		dirOffset = readBigEndian32( data + 12 + 4 * index );
+	}
+
+	// Offset table followed by 16-byte table records: tag, checksum, offset, length
+	if( ( dirOffset > size ) || ( size - dirOffset < 12 ) ) {
+		return false;
+	}
+	const uint8_t *dir = data + dirOffset;
+	const uint32_t version = readBigEndian32( dir );
+	if( ! ( ( 0x00010000 == version ) || ( 0 == std::memcmp( dir, "OTTO", 4 ) ) || ( 0 == std::memcmp( dir, "true", 4 ) ) ) ) {
+		return false;
+	}
+	const size_t numTables = ( static_cast<size_t>( dir[4] ) << 8 ) | static_cast<size_t>( dir[5] );
+	const size_t dirSize = 12 + 16 * numTables;
+	if( size - dirOffset < dirSize ) {
+		return false;
+	}
+
+	*hash = hashBytes( dir, dirSize, *hash );
+	return true;
+}
+
+//! Digest of the Format options that change the SDF of a glyph
+static uint64_t hashGlyphFormat( const SdfText::Format &format )
+{
+	uint64_t hash = hashBytes( &format.getSdfScale(), sizeof( vec2 ) );
+	hash = hashBytes( &format.getSdfPadding(), sizeof( ivec2 ), hash );
+	const float range = format.getSdfRange();
+	const float angle = format.getSdfAngle();
+	hash = hashBytes( &range, sizeof( range ), hash );
+	hash = hashBytes( &angle, sizeof( angle ), hash );
+	const int32_t options[] = { 
+		format.getSinglePrecision() ? 1 : 0, 
+		format.getRangeLimited() ? 1 : 0,
+		format.getSingleChannel() ? 1 : 0
+	};
+	return hashBytes( options, sizeof( options ), hash );
+}
+
+//! Digest of the Format options that change the atlas textures
+static uint64_t hashPageFormat( const SdfText::Format &format )
+{
+	uint64_t hash = hashBytes( &format.getTextureSize(), sizeof( ivec2 ) );
+	hash = hashBytes( &format.getSdfTileSpacing(), sizeof( ivec2 ), hash );
+	const int32_t numChannels = format.getSingleChannel() ? 1 : 3;
+	return hashBytes( &numChannels, sizeof( numChannels ), hash );
+}
+
+//! Digest of the box size and the DrawOptions that change the glyph measures of a string
+static uint64_t hashLayoutOptions( const ivec2 &boxSize, const SdfText::DrawOptions &options )
+{
+	const float values[] = { 
+		options.getTracking(), 
+		options.getLeading(), 
+		options.getScale()
+	};
+	const int32_t flags[] = { 
+		boxSize.x, 
+		boxSize.y, 
+		static_cast<int32_t>( options.getAlignment() ), 
+		options.getJustify() ? 1 : 0,
+		options.getLigate() ? 1 : 0
+	};
+	uint64_t hash = hashBytes( values, sizeof( values ) );
+	return hashBytes( flags, sizeof( flags ), hash );
+}
+
+//! Digest of the Format options that change the atlas contents. The bake thread count doesn't.
+static uint64_t hashFormat( const SdfText::Format &format )
+{
+	uint64_t hash = hashGlyphFormat( format ) ^ ( 31 * hashPageFormat( format ) );
+	const int32_t options[] = { 
+		static_cast<int32_t>( format.getPacking() ), 
+		format.getDynamic() ? 1 : 0,
+		format.getSharedPages() ? 1 : 0
+	};
+	return hashBytes( options, sizeof( options ), hash );
+}
+
+// =================================================================================================
+// FontFace
+// =================================================================================================
+//! A FreeType face over a font file mapped into memory, so the file is read in place rather than copied. Data 
+//! sources that aren't files, or files that can't be mapped, are read into a buffer instead.
+//!
+//! A FreeType face can only be used by one thread at a time, so threads lease faces from a pool of faces over the 
+//! same data. getFace() is the first face of the pool, caches and fonts are keyed by it. Apart from reading its 
+//! fields, FreeType calls on it have to go through a lease like on any other face of the pool.
+class FontFace {
+public:
+	FontFace( const ci::DataSourceRef &dataSource );
+	~FontFace();
+
+	FT_Face			getFace() const { return mFace; }
+
+	//! Exclusive use of a face of the pool, handed back when the lease goes away
+	class FaceLease {
+	public:
+		FaceLease( FontFace *fontFace, FT_Face face ) : mFontFace( fontFace ), mFace( face ) {}
+		FaceLease( FaceLease &&other ) : mFontFace( other.mFontFace ), mFace( other.mFace ) { other.mFace = nullptr; }
+		~FaceLease() { if( nullptr != mFace ) { mFontFace->release( mFace ); } }
+
+		FT_Face		get() const { return mFace; }
+
+	private:
+		FaceLease( const FaceLease& ) = delete;
+		FaceLease& operator=( const FaceLease& ) = delete;
+
+		FontFace	*mFontFace = nullptr;
+		FT_Face		mFace = nullptr;
+	};
+
+	//! Leases an idle face, opening another one over the same data if they're all in use
+	FaceLease		acquire();
+
+private:
+	//! Maps \a path into memory, returns false if it can't
+	bool			mapFile( const fs::path &path );
+	void			unmapFile();
+	void			release( FT_Face face );
+
+	ci::BufferRef			mFileData;
+	const uint8_t			*mMappedData = nullptr;
+	size_t					mMappedSize = 0;
+	const FT_Byte			*mData = nullptr;
+	FT_Long					mDataSize = 0;
+	FT_Face					mFace = nullptr;
+
+	std::mutex				mPoolMutex;
+	//! Every face over the data, the first one being mFace
+	std::vector<FT_Face>	mPoolFaces;
+	std::vector<FT_Face>	mIdleFaces;
+};
+
+using FontFaceRef = std::shared_ptr<FontFace>;
+
+// =================================================================================================
+// GlyphOutlineCache
+// =================================================================================================
+//! Outlines and metrics of the glyphs decoded so far, per face. Each glyph is loaded from FreeType once, 
+//! the atlas bounds, the SDF rendering and the glyph metrics all read the cached copy.
+//! The edges of a face's outlines live in that face's arena and are released together with the face.
+//! Safe to use from several threads, glyphs of different faces load concurrently.
+class GlyphOutlineCache {
+public:
+
+	struct Outline {
+		msdfgen::Shape					shape;
+		bool							hasShape = false;
+		double							left = 0.0;
+		double							bottom = 0.0;
+		double							right = 0.0;
+		double							top = 0.0;
+	};
+
+	const Outline&						get( FontFace &fontFace, SdfText::Font::Glyph glyphIndex );
+	//! Returns the hinted metrics of a glyph at \a size, fonts of different sizes share their face
+	const SdfText::Font::GlyphMetrics&	getMetrics( FontFace &fontFace, float size, SdfText::Font::Glyph glyphIndex );
+	void								erase( FT_Face face );
+
+private:
+	struct FaceOutlines {
+		//! Guards everything of the face, the arena included
+		std::mutex													mutex;
+		// Declared before the outlines so that it outlives their edges
+		msdfgen::EdgeArena											arena;
+		std::unordered_map<SdfText::Font::Glyph, Outline>			outlines;
+		//! Metrics per size in 26.6 points and glyph
+		std::map<std::pair<FT_F26Dot6, SdfText::Font::Glyph>, SdfText::Font::GlyphMetrics>	metrics;
+	};
+
+	FaceOutlines&					getFaceOutlines( FT_Face face );
+
+	//! Guards the map itself, the faces' entries have locks of their own
+	std::mutex						mMutex;
+	std::map<FT_Face, FaceOutlines>	mOutlines;
+};
+
+GlyphOutlineCache::FaceOutlines& GlyphOutlineCache::getFaceOutlines( FT_Face face )
+{
+	std::lock_guard<std::mutex> lock( mMutex );
+	return mOutlines[face];
+}
+
+const GlyphOutlineCache::Outline& GlyphOutlineCache::get( FontFace &fontFace, SdfText::Font::Glyph glyphIndex )
+{
+	FaceOutlines& faceOutlines = getFaceOutlines( fontFace.getFace() );
+	std::lock_guard<std::mutex> lock( faceOutlines.mutex );
+	auto it = faceOutlines.outlines.find( glyphIndex );
+	if( faceOutlines.outlines.end() != it ) {
+		return it->second;
+	}
+
+	Outline& outline = faceOutlines.outlines[glyphIndex];
+	// Unscaled outline for the SDF
+	outline.shape.arena = &faceOutlines.arena;
+	FontFace::FaceLease face = fontFace.acquire();
+	if( msdfgen::loadGlyph( outline.shape, face.get(), glyphIndex ) ) {
+		outline.hasShape = true;
+		outline.shape.bounds( outline.left, outline.bottom, outline.right, outline.top );
+	}
+	return outline;
+}
+
+const SdfText::Font::GlyphMetrics& GlyphOutlineCache::getMetrics( FontFace &fontFace, float size, SdfText::Font::Glyph glyphIndex )
+{
+	const FT_F26Dot6 charSize = static_cast<FT_F26Dot6>( size * 64.0f );
+	FaceOutlines& faceOutlines = getFaceOutlines( fontFace.getFace() );
+	std::lock_guard<std::mutex> lock( faceOutlines.mutex );
+	auto it = faceOutlines.metrics.find( std::make_pair( charSize, glyphIndex ) );
+	if( faceOutlines.metrics.end() != it ) {
+		return it->second;
+	}
+
+	SdfText::Font::GlyphMetrics& metrics = faceOutlines.metrics[std::make_pair( charSize, glyphIndex )];
+	// Metrics at the size, hinted
+	FontFace::FaceLease face = fontFace.acquire();
+	FT_Set_Char_Size( face.get(), 0, charSize, 0, 72 );
+	if( FT_Err_Ok == FT_Load_Glyph( face.get(), glyphIndex, FT_LOAD_DEFAULT ) ) {
+		FT_GlyphSlot slot = face.get()->glyph;
+		metrics.advance = vec2( slot->linearHoriAdvance, slot->linearVertAdvance ) / 65536.0f;
+		metrics.minimum = vec2( slot->metrics.horiBearingX, slot->metrics.vertBearingY - slot->metrics.height ) / 64.0f;
+		metrics.maximum = vec2( slot->metrics.horiBearingX + slot->metrics.width, slot->metrics.vertBearingY ) / 64.0f;
+	}
+	return metrics;
+}
+
+void GlyphOutlineCache::erase( FT_Face face )
+{
+	std::lock_guard<std::mutex> lock( mMutex );
+	mOutlines.erase( face );
+}
+
+// =================================================================================================
+// SkylinePacker
+// =================================================================================================
+//! Packs rectangles into a page by tracking the top edge of the rectangles placed so far and putting 
+//! each new one where its top ends up lowest. Works best with the rectangles inserted tallest first.
+class SkylinePacker {
+public:
+	SkylinePacker( const ivec2 &pageSize );
+
+	//! Places a rectangle, returns false if it doesn't fit on the page
+	bool	insert( const ivec2 &size, ivec2 *position );
+
+private:
+	struct Segment {
+		int x;
+		int y;
+		int width;
+	};
+
+	//! Returns the y at which a rectangle fits with its left edge on segment \a index, or -1 if it doesn't fit there
+	int		fit( size_t index, const ivec2 &size ) const;
+
+	ivec2					mPageSize;
+	std::vector<Segment>	mSkyline;
+};
+
+SkylinePacker::SkylinePacker( const ivec2 &pageSize )
+	: mPageSize( pageSize )
+{
+	Segment segment = { 0, 0, pageSize.x };
+	mSkyline.push_back( segment );
+}
+
+int SkylinePacker::fit( size_t index, const ivec2 &size ) const
+{
+	int x = mSkyline[index].x;
+	if( x + size.x > mPageSize.x ) {
+		return -1;
+	}
+
+	// The rectangle rests on the highest segment below it
+	int y = 0;
+	int widthLeft = size.x;
+	for( size_t i = index; widthLeft > 0; ++i ) {
+		y = std::max( y, mSkyline[i].y );
+		if( y + size.y > mPageSize.y ) {
+			return -1;
+		}
+		widthLeft -= mSkyline[i].width;
+	}
+	return y;
+}
+
+bool SkylinePacker::insert( const ivec2 &size, ivec2 *position )
+{
+	// Lowest top edge wins, ties go to the narrowest segment
+	size_t bestIndex = mSkyline.size();
+	int bestTop = std::numeric_limits<int>::max();
+	int bestWidth = std::numeric_limits<int>::max();
+	for( size_t i = 0; i < mSkyline.size(); ++i ) {
+		int y = fit( i, size );
+		if( y < 0 ) {
+			continue;
+		}
+		int top = y + size.y;
+		if( ( top < bestTop ) || ( ( top == bestTop ) && ( mSkyline[i].width < bestWidth ) ) ) {
+			bestIndex = i;
+			bestTop = top;
+			bestWidth = mSkyline[i].width;
+		}
+	}
+
+	if( mSkyline.size() == bestIndex ) {
+		return false;
+	}
+
+	*position = ivec2( mSkyline[bestIndex].x, bestTop - size.y );
+
+	// Raise the skyline under the rectangle
+	Segment segment = { position->x, bestTop, size.x };
+	mSkyline.insert( mSkyline.begin() + bestIndex, segment );
+	for( size_t i = bestIndex + 1; i < mSkyline.size(); ) {
+		int shrink = ( mSkyline[i - 1].x + mSkyline[i - 1].width ) - mSkyline[i].x;
+		if( shrink <= 0 ) {
+			break;
+		}
+		if( mSkyline[i].width > shrink ) {
+			mSkyline[i].x += shrink;
+			mSkyline[i].width -= shrink;
+			break;
+		}
+		mSkyline.erase( mSkyline.begin() + i );
+	}
+
+	// Merge neighbors at the same height
+	for( size_t i = 0; i + 1 < mSkyline.size(); ) {
+		if( mSkyline[i].y == mSkyline[i + 1].y ) {
+			mSkyline[i].width += mSkyline[i + 1].width;
+			mSkyline.erase( mSkyline.begin() + i + 1 );
+		}
+		else {
+			++i;
+		}
+	}
+
+	return true;
+}
 
 // =================================================================================================
 // SdfText::TextureAtlas
@@ -220,47 +627,190 @@ static gl::GlslProgRef sDefaultShader;
 class SdfText::TextureAtlas {
 public:
 
+	//! Digests of the font file, the format and the character set, so a lookup never touches FreeType
 	struct CacheKey {
-		std::string mFamilyName;
-		std::string mStyleName;
-		std::string mUtf8Chars;
-		ivec2		mTextureSize = ivec2( 0 );
-		ivec2		mSdfBitmapSize = ivec2( 0 );
+		uint64_t	mFontHash = 0;
+		uint64_t	mFormatHash = 0;
+		uint64_t	mCharsHash = 0;
 		bool operator==( const CacheKey& rhs ) const { 
-			return ( mFamilyName == rhs.mFamilyName ) &&
-				   ( mStyleName == rhs.mStyleName ) && 
-				   ( mUtf8Chars == rhs.mUtf8Chars ) &&
-				   ( mTextureSize == rhs.mTextureSize ) &&
-				   ( mSdfBitmapSize == rhs.mSdfBitmapSize );
+			return ( mFontHash == rhs.mFontHash ) &&
+				   ( mFormatHash == rhs.mFormatHash ) &&
+				   ( mCharsHash == rhs.mCharsHash );
 		}
 		bool operator!=( const CacheKey& rhs ) const {
-			return ( mFamilyName != rhs.mFamilyName ) ||
-				   ( mStyleName != rhs.mStyleName ) || 
-				   ( mUtf8Chars != rhs.mUtf8Chars ) ||
-				   ( mTextureSize != rhs.mTextureSize ) ||
-				   ( mSdfBitmapSize != rhs.mSdfBitmapSize );
+			return ( mFontHash != rhs.mFontHash ) ||
+				   ( mFormatHash != rhs.mFormatHash ) ||
+				   ( mCharsHash != rhs.mCharsHash );
+		}
+	};
+
+	struct CacheKeyHash {
+		size_t operator()( const CacheKey& key ) const {
+			return static_cast<size_t>( key.mFontHash ^ ( key.mFormatHash * 31 ) ^ ( key.mCharsHash * 1000003 ) );
 		}
 	};
 
-	typedef std::vector<std::pair<CacheKey, SdfText::TextureAtlasRef>> AtlasCacher;
+	//! Least recently used first
+	typedef std::list<std::pair<CacheKey, SdfText::TextureAtlasRef>> AtlasCacher;
+	typedef std::unordered_map<CacheKey, AtlasCacher::iterator, CacheKeyHash> AtlasIndex;
+
+	//! A glyph of a face, rendered with a given format
+	struct GlyphKey {
+		uint64_t				mFontHash = 0;
+		uint64_t				mGlyphFormatHash = 0;
+		SdfText::Font::Glyph	mGlyph = 0;
+		bool operator==( const GlyphKey& rhs ) const { 
+			return ( mFontHash == rhs.mFontHash ) &&
+				   ( mGlyphFormatHash == rhs.mGlyphFormatHash ) &&
+				   ( mGlyph == rhs.mGlyph );
+		}
+	};
+
+	struct GlyphKeyHash {
+		size_t operator()( const GlyphKey& key ) const {
+			return static_cast<size_t>( key.mFontHash ^ ( key.mGlyphFormatHash * 31 ) ^ ( static_cast<uint64_t>( key.mGlyph ) * 1000003 ) );
+		}
+	};
+
+	//! Textures and the free space left on them. An atlas owns its pages unless its format shares them, then the atlases 
+	//! of every font with the same texture size and tile spacing pack their glyphs onto the same pages.
+	struct Pages {
+		//! Atlases on shared pages may be laid out on different threads
+		std::mutex						mMutex;
+		std::vector<gl::TextureRef>		mTextures;
+		std::vector<SkylinePacker>		mPackers;
+		//! Area covered by tiles, in texels
+		double							mTileArea = 0.0;
+		//! Tile on shared pages, counting the atlases that use it
+		struct Tile {
+			uint32_t	mTextureIndex = 0;
+			Area		mTexCoords;
+			uint32_t	mRefCount = 0;
+		};
+		//! Tiles on shared pages, so atlases of the same face and glyph format reuse them
+		std::unordered_map<GlyphKey, Tile, GlyphKeyHash>	mTiles;
+		//! Tiles in use on each shared page, pages that run empty are packed again from scratch
+		std::vector<uint32_t>			mPageTileCounts;
+		//! Emptied pages that still hold old glyphs, they're cleared before new tiles go on them
+		std::set<size_t>				mStalePages;
+	};
+
+	typedef std::shared_ptr<Pages> PagesRef;
 
 	// ---------------------------------------------------------------------------------------------
 
-	virtual ~TextureAtlas() {}
+	//! Gives the tiles back to shared pages once no other atlas uses them
+	virtual ~TextureAtlas();
 
-	static SdfText::TextureAtlasRef create( FT_Face face, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices );
+	//! Packs the glyphs onto \a sharedPages if the format shares them, otherwise onto pages of its own. With \a deferBake 
+	//! the glyphs are only laid out, bakeAsync() or finishBake() generate and upload them.
+	static SdfText::TextureAtlasRef create( const FontFaceRef &fontFace, uint64_t fontHash, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines, const PagesRef &sharedPages = PagesRef(), bool deferBake = false );
 
 	static ivec2 calculateSdfBitmapSize( const vec2 &sdfScale, const ivec2& sdfPadding, const vec2 &maxGlyphSize );
 
+	//! Returns the fraction of the texture area covered by glyph tiles
+	float calculateOccupancy() const;
+	//! Returns the memory taken up by the textures, in bytes
+	size_t calculateTextureMemory() const;
+	//! Returns whether releasing the atlas frees anything. On shared pages that's only the case when some of its 
+	//! tiles aren't used by another atlas.
+	bool hasExclusiveTiles() const;
+
+	const PagesRef&	getPages() const { return mPages; }
+
+	//! Generates the glyphs that aren't on the atlas yet and uploads them into free space, adding textures once 
+	//! the existing ones are full. Only dynamic atlases take new glyphs. Has to be called on the GL thread.
+	void addGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines );
+	//! Fills in the bounds and tile size \a glyphIndex will have once it's added, without generating or packing it, so 
+	//! text can be measured before it's drawn. The tile has no texture yet, its texture index is ~0. Returns \c false 
+	//! for glyphs without an outline, they never go on the atlas. Only reads the outline cache, safe on any thread.
+	bool measureGlyph( SdfText::Font::Glyph glyphIndex, GlyphOutlineCache &outlines, SdfText::Font::GlyphInfo *glyphInfo ) const;
+
+	//! Starts generating the glyphs laid out by a deferred create() on a worker thread
+	void bakeAsync();
+	//! Uploads the glyphs once they're generated, returns whether the atlas is complete. Waits for a worker that's 
+	//! still busy if \a wait is set and generates the glyphs on the calling thread if bakeAsync() wasn't called. 
+	//! Has to be called on the GL thread.
+	bool finishBake( bool wait );
+
 private:
 	TextureAtlas();
-	TextureAtlas( FT_Face face, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices );
+	TextureAtlas( const FontFaceRef &fontFace, uint64_t fontHash, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines, const PagesRef &sharedPages, bool deferBake );
 	friend class SdfText;
 
-	FT_Face							mFace = nullptr;
-	std::vector<gl::TextureRef>		mTextures;
+	//! Glyph outline, kept in its flat form for rendering
+	struct GlyphShape {
+		msdfgen::CompiledShape	shape;
+		bool					hasContours;
+	};
+
+	typedef std::unordered_map<SdfText::Font::Glyph, GlyphShape> GlyphShapeMap;
+
+	//! Render position and tile size of a glyph
+	struct RenderGlyph {
+		uint32_t glyphIndex;
+		ivec2    position;
+		ivec2    size;
+	};
+
+	//! A glyph laid out on the atlas, waiting to be generated and uploaded
+	struct BakeTile {
+		const GlyphShape		*shape;
+		vec2					originOffset;
+		size_t					atlasIndex;
+		ivec2					position;
+		ivec2					size;
+		//! Pixels of a tile uploaded into an existing texture, rows padded to the default GL unpack alignment of 4
+		int						rowBytes;
+		std::vector<uint8_t>	pixels;
+	};
+
+	//! Glyphs laid out on the atlas but not generated or uploaded yet. Generating them touches neither FreeType nor GL, 
+	//! nor anything else of the atlas, so it may run on a worker thread.
+	struct PendingBake {
+		GlyphShapeMap				glyphShapes;
+		std::vector<BakeTile>		tiles;
+		//! Bitmaps of whole new textures the tiles are generated into, single-channel atlases use the channels. Empty when 
+		//! the tiles go into existing textures.
+		std::vector<Surface8u>		surfaces;
+		std::vector<Channel8u>		channels;
+		//! Whether the upload reports the bake
+		bool						report = false;
+	};
+
+	//! Fills in the bounds of the glyphs and compiles their shapes, unless \a glyphShapes is null
+	void						prepareGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines, GlyphShapeMap *glyphShapes );
+	//! Returns the prepared glyphs with their tight tile sizes, tallest first
+	std::vector<RenderGlyph>	sortedRenderGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices ) const;
+	//! Returns the tight tile size of a glyph with bounds \a originOffset and \a size
+	ivec2						calculateTileSize( const vec2 &originOffset, const vec2 &size ) const;
+	//! Finds room for a tile, returns the index of the atlas it goes on
+	size_t						packTile( const ivec2 &size, ivec2 *position );
+	//! Generates the SDF of a glyph into a tile at \a dst
+	void						bakeTile( const GlyphShape &glyphShape, const vec2 &originOffset, const ivec2 &size, uint8_t *dst, int pixelInc, int rowBytes ) const;
+	//! Runs \a job for every index below \a count on the bake threads
+	void						runBakeJobs( size_t count, const std::function<void( size_t )> &job ) const;
+	//! Lays out the glyphs that aren't on the atlas yet as tiles in the free space, to be uploaded into the textures 
+	//! one at a time. Glyphs already on shared pages are reused.
+	void						packGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines );
+	//! Generates the pending tiles, safe to run on a worker thread
+	void						bakePending();
+	//! Uploads the pending tiles, has to be called on the GL thread
+	void						uploadPending();
+
+	FontFaceRef						mFontFace;
+	PagesRef						mPages;
 	SdfText::Font::GlyphInfoMap		mGlyphInfo;
 
+	SdfText::Format					mFormat;
+	bool							mDynamic = false;
+	bool							mSharedPages = false;
+	bool							mInvertSdf = false;
+	//! 1 for single-channel SDF in R8 textures, 3 for MSDF in RGB8 textures
+	uint32_t						mNumChannels = 3;
+	uint64_t						mFontHash = 0;
+	uint64_t						mGlyphFormatHash = 0;
+
 	//! Base scale that SDF generator uses is size 32 at 72 DPI. A scale of 1.5, 2.0, and 3.0 translates to size 48, 64 and 96 and 72 DPI.
 	vec2						mSdfScale = vec2( 1.0f );
 	vec2						mSdfPadding = vec2( 2.0f );
@@ -268,28 +818,435 @@ private:
 	vec2						mMaxGlyphSize = vec2( 0.0f );
 	float						mMaxAscent = 0.0f;
 	float						mMaxDescent = 0.0f;
+
+	std::unique_ptr<PendingBake>	mPendingBake;
+	//! Declared last, so destroying the atlas waits for the worker before anything it uses goes away
+	std::future<void>				mBakeFuture;
 };
 
 SdfText::TextureAtlas::TextureAtlas()
+	: mPages( new Pages() )
 {
 }
 
-SdfText::TextureAtlas::TextureAtlas( FT_Face face, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices )
-	: mFace( face ), mSdfScale( format.getSdfScale() ), mSdfPadding( format.getSdfPadding() )
+SdfText::TextureAtlas::TextureAtlas( const FontFaceRef &fontFace, uint64_t fontHash, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines, const PagesRef &sharedPages, bool deferBake )
+	: mFontFace( fontFace ), mFormat( format ), mDynamic( format.getDynamic() ), mSharedPages( format.getSharedPages() && sharedPages ), 
+	  mNumChannels( format.getSingleChannel() ? 1 : 3 ), mFontHash( fontHash ), mGlyphFormatHash( hashGlyphFormat( format ) ), mSdfScale( format.getSdfScale() ), mSdfPadding( format.getSdfPadding() )
 {
 	const ivec2& tileSpacing = format.getSdfTileSpacing();
 
 	// CW (TTF) vs CCW (OTF) - SDF needs to be inverted if font is OTF
-	bool invertSdf = ( std::string( "OTTO" ) ==  std::string( reinterpret_cast<const char *>( face->stream->base ) ) );
+	mInvertSdf = ( std::string( "OTTO" ) ==  std::string( reinterpret_cast<const char *>( mFontFace->getFace()->stream->base ) ) );
+
+	// Other atlases may have left room on the shared pages, so tiles go on them one at a time like dynamic glyphs do
+	if( mSharedPages ) {
+		mPages = sharedPages;
+		packGlyphs( glyphIndices, outlines );
+		mSdfBitmapSize = SdfText::TextureAtlas::calculateSdfBitmapSize( mSdfScale, mSdfPadding, mMaxGlyphSize );
+		if( mPendingBake ) {
+			mPendingBake->report = true;
+		}
+		if( ! deferBake ) {
+			finishBake( true );
+		}
+		return;
+	}
+
+	mPages = PagesRef( new Pages() );
+	mPendingBake.reset( new PendingBake() );
+	mPendingBake->report = true;
 
 	// Build glyph information that will be needed later
+	GlyphShapeMap &glyphShapes = mPendingBake->glyphShapes;
+	prepareGlyphs( glyphIndices, outlines, &glyphShapes );
+
+	// Determine render bitmap size
+	mSdfBitmapSize = SdfText::TextureAtlas::calculateSdfBitmapSize( mSdfScale, mSdfPadding, mMaxGlyphSize );
+
+	std::vector<std::vector<RenderGlyph>> renderAtlases;
+
+	if( mDynamic || ( SdfText::SKYLINE == format.getPacking() ) ) {
+		for( auto& renderGlyph : sortedRenderGlyphs( glyphIndices ) ) {
+			size_t atlasIndex = packTile( renderGlyph.size, &renderGlyph.position );
+			if( renderAtlases.size() <= atlasIndex ) {
+				renderAtlases.resize( atlasIndex + 1 );
+			}
+			renderAtlases[atlasIndex].push_back( renderGlyph );
+		}
+		// Only dynamic atlases pack more tiles later
+		if( ! mDynamic ) {
+			mPages->mPackers.clear();
+		}
+	}
+	else {
+		// Determine glyph counts (per texture atlas)
+		const size_t numGlyphColumns   = ( format.getTextureWidth()  / ( mSdfBitmapSize.x + tileSpacing.x ) );
+		const size_t numGlyphRows      = ( format.getTextureHeight() / ( mSdfBitmapSize.y + tileSpacing.y ) );
+		const size_t numGlyphsPerAtlas = numGlyphColumns * numGlyphRows;
+
+		// Build the atlases
+		size_t curRenderIndex = 0;
+		ivec2 curRenderPos = ivec2( 0 );
+		std::vector<RenderGlyph> curRenderGlyphs;
+		for( std::vector<SdfText::Font::Glyph>::const_iterator glyphIndexIt = glyphIndices.begin(); glyphIndexIt != glyphIndices.end() ;  ) {
+			// Build render glyph
+			RenderGlyph renderGlyph;
+			renderGlyph.glyphIndex = *glyphIndexIt;
+			renderGlyph.position.x = curRenderPos.x;
+			renderGlyph.position.y = curRenderPos.y;
+			renderGlyph.size = mSdfBitmapSize;
+			
+			// Add to render atlas
+			curRenderGlyphs.push_back( renderGlyph );
+
+			// Increment index
+			++curRenderIndex;
+			// Increment glyph index iterator
+			++glyphIndexIt;
+			// Advance horizontal position
+			curRenderPos.x += mSdfBitmapSize.x;
+			curRenderPos.x += tileSpacing.x;
+			// Move to next row if needed
+			if( 0 == ( curRenderIndex % numGlyphColumns ) ) {
+				curRenderPos.x = 0;
+				curRenderPos.y += mSdfBitmapSize.y;
+				curRenderPos.y += tileSpacing.y;
+			}
+
+			if( ( numGlyphsPerAtlas == curRenderIndex ) || ( glyphIndices.end() == glyphIndexIt ) ) {
+				// Copy current atlas
+				renderAtlases.push_back( curRenderGlyphs );
+				// Reset values
+				curRenderIndex = 0;
+				curRenderPos = ivec2( 0 );
+				curRenderGlyphs.clear();
+			}
+		}
+	}
+
+	// Surfaces, or channels for single-channel SDFs - one per atlas, every glyph renders into its own tile so the bake order doesn't matter
+	for( size_t atlasIndex = 0; atlasIndex < renderAtlases.size(); ++atlasIndex ) {
+		if( 1 == mNumChannels ) {
+			Channel8u channel( format.getTextureWidth(), format.getTextureHeight() );
+			ip::fill( &channel, static_cast<uint8_t>( 0 ) );
+			mPendingBake->channels.push_back( channel );
+		}
+		else {
+			Surface8u surface( format.getTextureWidth(), format.getTextureHeight(), false );
+			ip::fill( &surface, Color8u( 0, 0, 0 ) );
+			mPendingBake->surfaces.push_back( surface );
+		}
+	}
+
+	// Bake jobs, tex coords are assigned up front so the workers never touch mGlyphInfo
+	for( size_t atlasIndex = 0; atlasIndex < renderAtlases.size(); ++atlasIndex ) {
+		for( const auto& renderGlyph : renderAtlases[atlasIndex] ) {
+			auto it = mGlyphInfo.find( renderGlyph.glyphIndex );
+			if( mGlyphInfo.end() == it ) {
+				continue;
+			}
+
+			// Tex coords
+			it->second.mTextureIndex = static_cast<uint32_t>( atlasIndex );
+			it->second.mTexCoords = Area( 0, 0, renderGlyph.size.x, renderGlyph.size.y ) + renderGlyph.position;
+			mPages->mTileArea += static_cast<double>( renderGlyph.size.x ) * static_cast<double>( renderGlyph.size.y );
+
+			BakeTile tile;
+			tile.shape = &glyphShapes[renderGlyph.glyphIndex];
+			tile.originOffset = it->second.mOriginOffset;
+			tile.atlasIndex = atlasIndex;
+			tile.position = renderGlyph.position;
+			tile.size = renderGlyph.size;
+			tile.rowBytes = 0;
+			mPendingBake->tiles.push_back( tile );
+		}
+	}
+
+	if( ! deferBake ) {
+		finishBake( true );
+	}
+}
+
+SdfText::TextureAtlas::~TextureAtlas()
+{
+	if( ! mSharedPages ) {
+		return;
+	}
+
+	// The tiles no other atlas uses go back to the pages. Skyline packers can't free single tiles, so space is 
+	// only reclaimed once a page runs empty, it's packed again from scratch then.
+	std::lock_guard<std::mutex> pagesLock( mPages->mMutex );
+	GlyphKey glyphKey;
+	glyphKey.mFontHash = mFontHash;
+	glyphKey.mGlyphFormatHash = mGlyphFormatHash;
+	for( const auto& elem : mGlyphInfo ) {
+		glyphKey.mGlyph = elem.first;
+		auto tileIt = mPages->mTiles.find( glyphKey );
+		if( ( mPages->mTiles.end() == tileIt ) || ( --tileIt->second.mRefCount > 0 ) ) {
+			continue;
+		}
+
+		const uint32_t atlasIndex = tileIt->second.mTextureIndex;
+		const Area &texCoords = tileIt->second.mTexCoords;
+		mPages->mTileArea -= static_cast<double>( texCoords.getWidth() ) * static_cast<double>( texCoords.getHeight() );
+		mPages->mTiles.erase( tileIt );
+		if( 0 == --mPages->mPageTileCounts[atlasIndex] ) {
+			mPages->mPackers[atlasIndex] = SkylinePacker( mFormat.getTextureSize() );
+			mPages->mStalePages.insert( atlasIndex );
+		}
+	}
+
+	// Empty pages at the end release their textures
+	while( ( ! mPages->mPageTileCounts.empty() ) && ( 0 == mPages->mPageTileCounts.back() ) ) {
+		const size_t atlasIndex = mPages->mPageTileCounts.size() - 1;
+		mPages->mPageTileCounts.pop_back();
+		mPages->mPackers.pop_back();
+		mPages->mStalePages.erase( atlasIndex );
+		if( mPages->mTextures.size() > atlasIndex ) {
+			mPages->mTextures.resize( atlasIndex );
+		}
+	}
+	if( mPages->mTiles.empty() ) {
+		mPages->mTileArea = 0.0;
+	}
+}
+
+void SdfText::TextureAtlas::addGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines )
+{
+	if( ! mDynamic ) {
+		return;
+	}
+
+	finishBake( true );
+	packGlyphs( glyphIndices, outlines );
+	finishBake( true );
+}
+
+void SdfText::TextureAtlas::bakeAsync()
+{
+	if( mPendingBake && ( ! mBakeFuture.valid() ) ) {
+		mBakeFuture = std::async( std::launch::async, [this]() { bakePending(); } );
+	}
+}
+
+bool SdfText::TextureAtlas::finishBake( bool wait )
+{
+	if( ! mPendingBake ) {
+		return true;
+	}
+
+	if( mBakeFuture.valid() ) {
+		if( ( ! wait ) && ( std::future_status::ready != mBakeFuture.wait_for( std::chrono::seconds( 0 ) ) ) ) {
+			return false;
+		}
+		// Rethrows anything the worker threw
+		mBakeFuture.get();
+	}
+	else {
+		bakePending();
+	}
+
+	uploadPending();
+	mPendingBake.reset();
+	return true;
+}
+
+void SdfText::TextureAtlas::bakePending()
+{
+	PendingBake &pendingBake = *mPendingBake;
+	const bool wholeTextures = ! ( pendingBake.surfaces.empty() && pendingBake.channels.empty() );
+	runBakeJobs( pendingBake.tiles.size(), [&]( size_t tileIndex ) {
+		BakeTile &tile = pendingBake.tiles[tileIndex];
+		uint8_t *dst = nullptr;
+		int pixelInc = static_cast<int>( mNumChannels );
+		int rowBytes = tile.rowBytes;
+		// Straight into the bitmap of a new texture...
+		if( wholeTextures ) {
+			uint8_t *data = nullptr;
+			if( 1 == mNumChannels ) {
+				Channel8u &channel = pendingBake.channels[tile.atlasIndex];
+				data = channel.getData();
+				pixelInc = static_cast<int>( channel.getIncrement() );
+				rowBytes = static_cast<int>( channel.getRowBytes() );
+			}
+			else {
+				Surface8u &surface = pendingBake.surfaces[tile.atlasIndex];
+				data = surface.getData();
+				pixelInc = static_cast<int>( surface.getPixelInc() );
+				rowBytes = static_cast<int>( surface.getRowBytes() );
+			}
+			dst = data + ( tile.position.y * rowBytes ) + ( tile.position.x * pixelInc );
+		}
+		// ...or into the tile's own pixels
+		else {
+			tile.pixels.resize( tile.rowBytes * tile.size.y );
+			dst = tile.pixels.data();
+		}
+		bakeTile( *tile.shape, tile.originOffset, tile.size, dst, pixelInc, rowBytes );
+	} );
+}
+
+void SdfText::TextureAtlas::uploadPending()
+{
+	PendingBake &pendingBake = *mPendingBake;
+	std::unique_lock<std::mutex> pagesLock( mPages->mMutex );
+
+	// Create textures from the bitmaps...
+	if( ! ( pendingBake.surfaces.empty() && pendingBake.channels.empty() ) ) {
+		for( const auto& channel : pendingBake.channels ) {
+			mPages->mTextures.push_back( gl::Texture::create( channel ) );
+		}
+		for( const auto& surface : pendingBake.surfaces ) {
+			mPages->mTextures.push_back( gl::Texture::create( surface ) );
+
+			// Debug output
+			//writeImage( "sdfText_" + std::to_string( mPages->mTextures.size() - 1 ) + ".png", surface );
+		}
+	}
+	// ...or upload the tiles, adding textures if the new tiles didn't fit on the existing ones
+	else {
+		// Single-channel textures are luminance on ES 2
+#if defined( CINDER_GL_ES_2 )
+		const GLenum dataFormat = ( 1 == mNumChannels ) ? GL_LUMINANCE : GL_RGB;
+#else
+		const GLenum dataFormat = ( 1 == mNumChannels ) ? GL_RED : GL_RGB;
+#endif
+
+		auto createBlankTexture = [this]() -> gl::TextureRef {
+			if( 1 == mNumChannels ) {
+				Channel8u channel( mFormat.getTextureWidth(), mFormat.getTextureHeight() );
+				ip::fill( &channel, static_cast<uint8_t>( 0 ) );
+				return gl::Texture::create( channel );
+			}
+			else {
+				Surface8u surface( mFormat.getTextureWidth(), mFormat.getTextureHeight(), false );
+				ip::fill( &surface, Color8u( 0, 0, 0 ) );
+				return gl::Texture::create( surface );
+			}
+		};
+
+		for( const auto& tile : pendingBake.tiles ) {
+			while( mPages->mTextures.size() <= tile.atlasIndex ) {
+				mPages->mTextures.push_back( createBlankTexture() );
+			}
+			// Pages that ran empty still show the glyphs of released atlases
+			if( mPages->mStalePages.erase( tile.atlasIndex ) > 0 ) {
+				mPages->mTextures[tile.atlasIndex] = createBlankTexture();
+			}
+
+			const gl::TextureRef &tex = mPages->mTextures[tile.atlasIndex];
+			ScopedTextureBind texBindScp( tex );
+			glTexSubImage2D( tex->getTarget(), 0, tile.position.x, tile.position.y, tile.size.x, tile.size.y, dataFormat, GL_UNSIGNED_BYTE, tile.pixels.data() );
+		}
+	}
+
+	const size_t numTextures = mPages->mTextures.size();
+	pagesLock.unlock();
+
+	if( pendingBake.report ) {
+		CI_LOG_I( "SdfText: baked " << pendingBake.tiles.size() << " glyphs onto " << numTextures << ( mSharedPages ? " shared" : "" ) << " textures, " << static_cast<int>( 100.0f * calculateOccupancy() + 0.5f ) << "% occupied" );
+	}
+}
+
+void SdfText::TextureAtlas::packGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines )
+{
+	// Skip the glyphs that are on the atlas already, other SdfTexts sharing it may have added them. 
+	// Glyphs another atlas put on the shared pages only need their bounds.
+	std::vector<SdfText::Font::Glyph> newGlyphIndices;
+	std::vector<SdfText::Font::Glyph> sharedGlyphIndices;
+	std::unique_lock<std::mutex> pagesLock( mPages->mMutex );
+	for( const auto& glyphIndex : glyphIndices ) {
+		if( ( mGlyphInfo.end() != mGlyphInfo.find( glyphIndex ) ) || ( std::end( newGlyphIndices ) != std::find( std::begin( newGlyphIndices ), std::end( newGlyphIndices ), glyphIndex ) ) ) {
+			continue;
+		}
+		GlyphKey glyphKey;
+		glyphKey.mFontHash = mFontHash;
+		glyphKey.mGlyphFormatHash = mGlyphFormatHash;
+		glyphKey.mGlyph = glyphIndex;
+		auto tileIt = mPages->mTiles.find( glyphKey );
+		if( mPages->mTiles.end() != tileIt ) {
+			SdfText::Font::GlyphInfo &glyphInfo = mGlyphInfo[glyphIndex];
+			glyphInfo.mTextureIndex = tileIt->second.mTextureIndex;
+			glyphInfo.mTexCoords = tileIt->second.mTexCoords;
+			++tileIt->second.mRefCount;
+			sharedGlyphIndices.push_back( glyphIndex );
+		}
+		else {
+			newGlyphIndices.push_back( glyphIndex );
+		}
+	}
+	pagesLock.unlock();
+
+	prepareGlyphs( sharedGlyphIndices, outlines, nullptr );
+	if( newGlyphIndices.empty() ) {
+		return;
+	}
+
+	mPendingBake.reset( new PendingBake() );
+	GlyphShapeMap &glyphShapes = mPendingBake->glyphShapes;
+	prepareGlyphs( newGlyphIndices, outlines, &glyphShapes );
+
+	// Pack the new tiles into the free space. Another thread may have put some of them on the pages meanwhile, 
+	// those are taken from there.
+	pagesLock.lock();
+	for( const auto& renderGlyph : sortedRenderGlyphs( newGlyphIndices ) ) {
+		GlyphKey glyphKey;
+		glyphKey.mFontHash = mFontHash;
+		glyphKey.mGlyphFormatHash = mGlyphFormatHash;
+		glyphKey.mGlyph = renderGlyph.glyphIndex;
+		if( mSharedPages ) {
+			auto tileIt = mPages->mTiles.find( glyphKey );
+			if( mPages->mTiles.end() != tileIt ) {
+				SdfText::Font::GlyphInfo &glyphInfo = mGlyphInfo[renderGlyph.glyphIndex];
+				glyphInfo.mTextureIndex = tileIt->second.mTextureIndex;
+				glyphInfo.mTexCoords = tileIt->second.mTexCoords;
+				++tileIt->second.mRefCount;
+				continue;
+			}
+		}
+
+		BakeTile tile;
+		tile.shape = &glyphShapes[renderGlyph.glyphIndex];
+		tile.size = renderGlyph.size;
+		tile.atlasIndex = packTile( renderGlyph.size, &tile.position );
+		// Rows padded to the default GL unpack alignment of 4
+		tile.rowBytes = ( static_cast<int>( mNumChannels ) * renderGlyph.size.x + 3 ) & ~3;
+
+		SdfText::Font::GlyphInfo &glyphInfo = mGlyphInfo[renderGlyph.glyphIndex];
+		glyphInfo.mTextureIndex = static_cast<uint32_t>( tile.atlasIndex );
+		glyphInfo.mTexCoords = Area( 0, 0, renderGlyph.size.x, renderGlyph.size.y ) + tile.position;
+		tile.originOffset = glyphInfo.mOriginOffset;
+		mPages->mTileArea += static_cast<double>( renderGlyph.size.x ) * static_cast<double>( renderGlyph.size.y );
+		if( mSharedPages ) {
+			Pages::Tile &sharedTile = mPages->mTiles[glyphKey];
+			sharedTile.mTextureIndex = glyphInfo.mTextureIndex;
+			sharedTile.mTexCoords = glyphInfo.mTexCoords;
+			sharedTile.mRefCount = 1;
+			if( mPages->mPageTileCounts.size() <= tile.atlasIndex ) {
+				mPages->mPageTileCounts.resize( tile.atlasIndex + 1, 0 );
+			}
+			++mPages->mPageTileCounts[tile.atlasIndex];
+		}
+
+		mPendingBake->tiles.push_back( tile );
+	}
+}
+
+void SdfText::TextureAtlas::prepareGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines, GlyphShapeMap *glyphShapes )
+{
+	const double sdfAngle = static_cast<double>( mFormat.getSdfAngle() );
+
+	// Scratch storage for the edges of the normalized shapes, reused for every glyph
+	msdfgen::EdgeArena shapeArena;
+
 	for( const auto& glyphIndex : glyphIndices ) {
 		// Glyph bounds, 
-		msdfgen::Shape shape;
-		if( msdfgen::loadGlyph( shape, face, glyphIndex ) ) {
-			double l, b, r, t;
-			l = b = r = t = 0.0;
-			shape.bounds( l, b, r, t );
+		const GlyphOutlineCache::Outline& outline = outlines.get( *mFontFace, glyphIndex );
+		if( outline.hasShape ) {
+			double l = outline.left;
+			double b = outline.bottom;
+			double r = outline.right;
+			double t = outline.top;
 			// Glyph bounds
 			Rectf bounds = Rectf( 
 				static_cast<float>( l ), 
@@ -305,141 +1262,156 @@ SdfText::TextureAtlas::TextureAtlas( FT_Face face, const SdfText::Format &format
 			mMaxAscent = std::max( mMaxAscent, static_cast<float>( t ) );
 			mMaxDescent = std::max( mMaxAscent, static_cast<float>( std::fabs( b ) ) );
 			//CI_LOG_I( (char)ch << " : " << mGlyphInfo[glyphIndex].mOriginOffset );
-		}	
-	}
 
-	// Determine render bitmap size
-	mSdfBitmapSize = SdfText::TextureAtlas::calculateSdfBitmapSize( mSdfScale, mSdfPadding, mMaxGlyphSize );
-	// Determine glyph counts (per texture atlas)
-	const size_t numGlyphColumns   = ( format.getTextureWidth()  / ( mSdfBitmapSize.x + tileSpacing.x ) );
-	const size_t numGlyphRows      = ( format.getTextureHeight() / ( mSdfBitmapSize.y + tileSpacing.y ) );
-	const size_t numGlyphsPerAtlas = numGlyphColumns * numGlyphRows;
-	
-	// Render position for each glyph
-	struct RenderGlyph {
-		uint32_t glyphIndex;
-		ivec2    position;
-	};
-
-	std::vector<std::vector<RenderGlyph>> renderAtlases;
+			if( nullptr == glyphShapes ) {
+				continue;
+			}
 
-	// Build the atlases
-	size_t curRenderIndex = 0;
-	ivec2 curRenderPos = ivec2( 0 );
-	std::vector<RenderGlyph> curRenderGlyphs;
-	for( std::vector<SdfText::Font::Glyph>::const_iterator glyphIndexIt = glyphIndices.begin(); glyphIndexIt != glyphIndices.end() ;  ) {
-		// Build render glyph
-		RenderGlyph renderGlyph;
-		renderGlyph.glyphIndex = *glyphIndexIt;
-		renderGlyph.position.x = curRenderPos.x;
-		renderGlyph.position.y = curRenderPos.y;
-		
-		// Add to render atlas
-		curRenderGlyphs.push_back( renderGlyph );
-
-		// Increment index
-		++curRenderIndex;
-		// Increment glyph index iterator
-		++glyphIndexIt;
-		// Advance horizontal position
-		curRenderPos.x += mSdfBitmapSize.x;
-		curRenderPos.x += tileSpacing.x;
-		// Move to next row if needed
-		if( 0 == ( curRenderIndex % numGlyphColumns ) ) {
-			curRenderPos.x = 0;
-			curRenderPos.y += mSdfBitmapSize.y;
-			curRenderPos.y += tileSpacing.y;
-		}
-
-		if( ( numGlyphsPerAtlas == curRenderIndex ) || ( glyphIndices.end() == glyphIndexIt ) ) {
-			// Copy current atlas
-			renderAtlases.push_back( curRenderGlyphs );
-			// Reset values
-			curRenderIndex = 0;
-			curRenderPos = ivec2( 0 );
-			curRenderGlyphs.clear();
-		}
-	}
-
-	// Surface
-	Surface8u surface( format.getTextureWidth(), format.getTextureHeight(), false );
-	ip::fill( &surface, Color8u( 0, 0, 0 ) );
-	uint8_t *surfaceData   = surface.getData();
-	size_t surfacePixelInc = surface.getPixelInc();
-	size_t surfaceRowBytes = surface.getRowBytes();
-
-	// Render the atlases
-	const double sdfRange = static_cast<double>( format.getSdfRange() );
-	const double sdfAngle = static_cast<double>( format.getSdfAngle() );
-	msdfgen::Bitmap<msdfgen::FloatRGB> sdfBitmap( mSdfBitmapSize.x, mSdfBitmapSize.y );
-	uint32_t currentTextureIndex = 0;
-	for( size_t atlasIndex = 0; atlasIndex < renderAtlases.size(); ++atlasIndex ) {
-		const auto& renderGlyphs = renderAtlases[atlasIndex];
-		// Render atlas
-		for( const auto& renderGlyph : renderGlyphs ) {
-			msdfgen::Shape shape;
-			if( msdfgen::loadGlyph( shape, face, renderGlyph.glyphIndex ) ) {
-				shape.inverseYAxis = true;
-				shape.normalize();	
+			// Edge colors depend on the format, so the cached outline is left untouched
+			msdfgen::Shape shape( outline.shape, &shapeArena );
+			shape.inverseYAxis = true;
+			shape.normalize();	
 				
-				// Edge color
+			// Edge color, a single channel doesn't use it
+			if( 3 == mNumChannels ) {
 				msdfgen::edgeColoringSimple( shape, sdfAngle );
+			}
 
-				// Generate SDF
-				vec2 originOffset = mGlyphInfo[renderGlyph.glyphIndex].mOriginOffset;
-				float tx = mSdfPadding.x;
-				float ty = std::fabs( originOffset.y ) + mSdfPadding.y;
-				// mSdfScale will get applied to <tx, ty> by msdfgen
-				msdfgen::generateMSDF( sdfBitmap, shape, sdfRange, msdfgen::Vector2( mSdfScale.x, mSdfScale.y ), msdfgen::Vector2( tx, ty ) );
-
-				// Invert the SDF if needed, but only for glyphs that have contours to render. 
-				// Glyph without contours will produce and blank bitmap, inverting this produces
-				// a solid block. Which is undesirable.
-				if( invertSdf && ( ! shape.contours.empty() ) ) {
-					for( int y = 0; y < sdfBitmap.height(); ++y ) {
-						for( int x = 0; x < sdfBitmap.width(); ++x ) {
-							sdfBitmap( x, y ).r = 1.0f - sdfBitmap( x, y ).r;
-							sdfBitmap( x, y ).g = 1.0f - sdfBitmap( x, y ).g;
-							sdfBitmap( x, y ).b = 1.0f - sdfBitmap( x, y ).b;
-						}
-					}
-				}
+			GlyphShape &glyphShape = (*glyphShapes)[glyphIndex];
+			glyphShape.shape = msdfgen::CompiledShape( shape );
+			glyphShape.hasContours = ! shape.contours.empty();
+		}
+		// The compiled shape keeps its own copy of the edges
+		shapeArena.reset();
+	}
+}
 
-				// Copy bitmap
-				size_t dstOffset = ( renderGlyph.position.y * surfaceRowBytes ) + ( renderGlyph.position.x * surfacePixelInc );
-				uint8_t *dst = surfaceData + dstOffset;
-				for( int n = 0; n < mSdfBitmapSize.y; ++n ) {
-					Color8u *dstPixel = reinterpret_cast<Color8u *>( dst );
-					for( int m = 0; m < mSdfBitmapSize.x; ++m ) {
-						msdfgen::FloatRGB &src = sdfBitmap( m, n );
-						Color srcPixel = Color( src.r, src.g, src.b );
-						*dstPixel = srcPixel;
-						++dstPixel;
-					}
-					dst += surfaceRowBytes;
-				}
+std::vector<SdfText::TextureAtlas::RenderGlyph> SdfText::TextureAtlas::sortedRenderGlyphs( const std::vector<SdfText::Font::Glyph> &glyphIndices ) const
+{
+	std::vector<RenderGlyph> result;
+	for( const auto& glyphIndex : glyphIndices ) {
+		auto it = mGlyphInfo.find( glyphIndex );
+		if( mGlyphInfo.end() == it ) {
+			continue;
+		}
 
-				// Tex coords
-				mGlyphInfo[renderGlyph.glyphIndex].mTextureIndex = currentTextureIndex;
-				mGlyphInfo[renderGlyph.glyphIndex].mTexCoords = Area( 0, 0, mSdfBitmapSize.x, mSdfBitmapSize.y ) + renderGlyph.position;
-			}
+		RenderGlyph renderGlyph;
+		renderGlyph.glyphIndex = glyphIndex;
+		renderGlyph.size = calculateTileSize( it->second.mOriginOffset, it->second.mSize );
+		result.push_back( renderGlyph );
+	}
+
+	// Tallest first
+	std::stable_sort( std::begin( result ), std::end( result ),
+		[]( const RenderGlyph& a, const RenderGlyph& b ) -> bool {
+			return ( a.size.y > b.size.y ) || ( ( a.size.y == b.size.y ) && ( a.size.x > b.size.x ) );
+		}
+	);
+
+	return result;
+}
+
+ivec2 SdfText::TextureAtlas::calculateTileSize( const vec2 &originOffset, const vec2 &size ) const
+{
+	// Tiles are cropped from a cell big enough for the glyph, keeping its lower left corner where the SDF 
+	// generator puts the glyph origin. Space beyond the glyph's reach on the right and top is dropped.
+	float right = std::max( originOffset.x + size.x, 0.0f );
+	float top = originOffset.y + size.y + std::fabs( originOffset.y );
+	ivec2 result;
+	result.x = static_cast<int>( std::ceil( mSdfScale.x * ( right + 2.0f * mSdfPadding.x ) ) );
+	result.y = static_cast<int>( std::ceil( mSdfScale.y * ( top + 2.0f * mSdfPadding.y ) ) );
+	// Static atlases crop the shared cell, like GRID does. Glyphs added to dynamic ones later may be larger than the cell, 
+	// tiles on shared pages are used by atlases with other cells.
+	if( ! ( mDynamic || mSharedPages ) ) {
+		result.x = std::min( mSdfBitmapSize.x, result.x );
+		result.y = std::min( mSdfBitmapSize.y, result.y );
+	}
+	return result;
+}
+
+bool SdfText::TextureAtlas::measureGlyph( SdfText::Font::Glyph glyphIndex, GlyphOutlineCache &outlines, SdfText::Font::GlyphInfo *glyphInfo ) const
+{
+	// Same bounds as prepareGlyphs() and the same tile as sortedRenderGlyphs()
+	const GlyphOutlineCache::Outline& outline = outlines.get( *mFontFace, glyphIndex );
+	if( ! outline.hasShape ) {
+		return false;
+	}
+
+	glyphInfo->mOriginOffset = vec2( outline.left, outline.bottom );
+	glyphInfo->mSize = vec2( outline.right - outline.left, outline.top - outline.bottom );
+	const ivec2 tileSize = calculateTileSize( glyphInfo->mOriginOffset, glyphInfo->mSize );
+	glyphInfo->mTexCoords = Area( 0, 0, tileSize.x, tileSize.y );
+	glyphInfo->mTextureIndex = ~0u;
+	return true;
+}
+
+size_t SdfText::TextureAtlas::packTile( const ivec2 &size, ivec2 *position )
+{
+	// Each tile goes on the first atlas with room for it
+	ivec2 spacedSize = size + mFormat.getSdfTileSpacing();
+	std::vector<SkylinePacker> &packers = mPages->mPackers;
+	for( size_t atlasIndex = 0; atlasIndex < packers.size(); ++atlasIndex ) {
+		if( packers[atlasIndex].insert( spacedSize, position ) ) {
+			return atlasIndex;
+		}
+	}
+
+	packers.push_back( SkylinePacker( mFormat.getTextureSize() ) );
+	if( ! packers.back().insert( spacedSize, position ) ) {
+		throw cinder::Exception( "SdfText: glyph tile doesn't fit on an atlas texture" );
+	}
+	return packers.size() - 1;
+}
+
+void SdfText::TextureAtlas::bakeTile( const GlyphShape &glyphShape, const vec2 &originOffset, const ivec2 &size, uint8_t *dst, int pixelInc, int rowBytes ) const
+{
+	const double sdfRange = static_cast<double>( mFormat.getSdfRange() );
+	const msdfgen::Precision sdfPrecision = mFormat.getSinglePrecision() ? msdfgen::SINGLE_PRECISION : msdfgen::DOUBLE_PRECISION;
+
+	// Invert the SDF if needed, but only for glyphs that have contours to render. 
+	// Glyph without contours will produce and blank bitmap, inverting this produces
+	// a solid block. Which is undesirable.
+	bool invertGlyph = mInvertSdf && glyphShape.hasContours;
+
+	// Generate SDF straight into the tile
+	float tx = mSdfPadding.x;
+	float ty = std::fabs( originOffset.y ) + mSdfPadding.y;
+	// mSdfScale will get applied to <tx, ty> by msdfgen
+	if( 1 == mNumChannels ) {
+		msdfgen::generatePseudoSDF( dst, size.x, size.y, pixelInc, rowBytes, glyphShape.shape, sdfRange, msdfgen::Vector2( mSdfScale.x, mSdfScale.y ), msdfgen::Vector2( tx, ty ), mFormat.getRangeLimited(), invertGlyph );
+	}
+	else {
+		msdfgen::generateMSDF( dst, size.x, size.y, pixelInc, rowBytes, glyphShape.shape, sdfRange, msdfgen::Vector2( mSdfScale.x, mSdfScale.y ), msdfgen::Vector2( tx, ty ), 1.00000001, sdfPrecision, mFormat.getRangeLimited(), invertGlyph );
+	}
+}
+
+void SdfText::TextureAtlas::runBakeJobs( size_t count, const std::function<void( size_t )> &job ) const
+{
+	std::atomic<size_t> nextJob( 0 );
+	auto bakeWorker = [&]() {
+		for( size_t jobIndex = nextJob++; jobIndex < count; jobIndex = nextJob++ ) {
+			job( jobIndex );
 		}
-		// Create texture
-		gl::TextureRef tex = gl::Texture::create( surface );
-		mTextures.push_back( tex );
-		++currentTextureIndex;
+	};
 
-		// Debug output
-		//writeImage( "sdfText_" + std::to_string( atlasIndex ) + ".png", surface );
+	// Worker count
+	size_t numThreads = ( mFormat.getBakeThreadCount() > 0 ) ? static_cast<size_t>( mFormat.getBakeThreadCount() ) : static_cast<size_t>( std::thread::hardware_concurrency() );
+	numThreads = std::max<size_t>( 1, std::min<size_t>( numThreads, count ) );
 
-		// Reset
-		ip::fill( &surface, Color8u( 0, 0, 0 ) );		
+	// The workers only read the compiled shapes, FreeType isn't touched during the bake
+	std::vector<std::thread> workers;
+	for( size_t i = 1; i < numThreads; ++i ) {
+		workers.push_back( std::thread( bakeWorker ) );
+	}
+	bakeWorker();
+	for( auto& worker : workers ) {
+		worker.join();
 	}
 }
 
-SdfText::TextureAtlasRef SdfText::TextureAtlas::create( FT_Face face, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices )
+SdfText::TextureAtlasRef SdfText::TextureAtlas::create( const FontFaceRef &fontFace, uint64_t fontHash, const SdfText::Format &format, const std::vector<SdfText::Font::Glyph> &glyphIndices, GlyphOutlineCache &outlines, const PagesRef &sharedPages, bool deferBake )
 {
-	SdfText::TextureAtlasRef result = SdfText::TextureAtlasRef( new SdfText::TextureAtlas( face, format, glyphIndices ) );
+	SdfText::TextureAtlasRef result = SdfText::TextureAtlasRef( new SdfText::TextureAtlas( fontFace, fontHash, format, glyphIndices, outlines, sharedPages, deferBake ) );
 	return result;
 }
 
@@ -449,9 +1421,53 @@ cinder::ivec2 SdfText::TextureAtlas::calculateSdfBitmapSize( const vec2 &sdfScal
 	return result;
 }
 
+float SdfText::TextureAtlas::calculateOccupancy() const
+{
+	std::lock_guard<std::mutex> pagesLock( mPages->mMutex );
+	double textureArea = 0.0;
+	for( const auto& tex : mPages->mTextures ) {
+		textureArea += static_cast<double>( tex->getWidth() ) * static_cast<double>( tex->getHeight() );
+	}
+
+	return ( textureArea > 0.0 ) ? static_cast<float>( mPages->mTileArea / textureArea ) : 0.0f;
+}
+
+size_t SdfText::TextureAtlas::calculateTextureMemory() const
+{
+	std::lock_guard<std::mutex> pagesLock( mPages->mMutex );
+	size_t result = 0;
+	for( const auto& tex : mPages->mTextures ) {
+		// R8 or RGB8
+		result += mNumChannels * static_cast<size_t>( tex->getWidth() ) * static_cast<size_t>( tex->getHeight() );
+	}
+	return result;
+}
+
+bool SdfText::TextureAtlas::hasExclusiveTiles() const
+{
+	if( ! mSharedPages ) {
+		return true;
+	}
+
+	std::lock_guard<std::mutex> pagesLock( mPages->mMutex );
+	GlyphKey glyphKey;
+	glyphKey.mFontHash = mFontHash;
+	glyphKey.mGlyphFormatHash = mGlyphFormatHash;
+	for( const auto& elem : mGlyphInfo ) {
+		glyphKey.mGlyph = elem.first;
+		auto tileIt = mPages->mTiles.find( glyphKey );
+		if( ( mPages->mTiles.end() != tileIt ) && ( 1 == tileIt->second.mRefCount ) ) {
+			return true;
+		}
+	}
+	return false;
+}
+
 // =================================================================================================
 // SdfTextManager
 // =================================================================================================
+//! Owns the FreeType library, the fonts and the atlas cache. Safe to use from several threads, except for what 
+//! touches GL: atlas uploads and releasing atlases happen on the GL thread.
 class SdfTextManager {
 public:
 	~SdfTextManager();
@@ -459,6 +1475,9 @@ public:
 	static SdfTextManager			*instance();
 
 	FT_Library						getLibrary() const { return mLibrary; }
+	//! Opens a face over font data in memory, or returns null if it can't. Calls on the library itself have to be serialized.
+	FT_Face							newFace( const FT_Byte *data, FT_Long size );
+	void							doneFace( FT_Face face );
 
 	const std::vector<std::string>&	getNames( bool forceRefresh );
 	SdfText::Font					getDefault() const;
@@ -472,30 +1491,83 @@ public:
 			: key( aKey ), name( aName ), path( aPath ) {}
 	};
 
-	FontInfo 						getFontInfo( const std::string& fontName ) const;
+	FontInfo 						getFontInfo( const std::string& fontName );
+
+	void							setCatalogPath( const fs::path &path ) { std::lock_guard<std::recursive_mutex> lock( mMutex ); mCatalogPath = path; }
+
+	void							setTextureMemoryBudget( size_t bytes );
+	size_t							getTextureMemoryBudget() const { std::lock_guard<std::recursive_mutex> lock( mMutex ); return mTextureMemoryBudget; }
+	size_t							getTextureMemoryUsage() const;
+	//! Releases the least recently used atlases that no SdfText holds anymore, until the textures fit the budget
+	void							trimTextureAtlases();
 
 private:
 	SdfTextManager();
 
 	static SdfTextManager			*sInstance;
 
+	//! Guards everything but the library and the outline cache, which has locks of its own
+	mutable std::recursive_mutex	mMutex;
+	//! Guards the library and the tracked faces
+	std::mutex						mLibraryMutex;
 	FT_Library						mLibrary = nullptr;
 	bool							mFontsEnumerated = false;
 	std::vector<std::string>		mFontNames;
 	std::vector<FontInfo>			mFontInfos;
+	//! Font keys mapped to the first font with that key
+	std::unordered_map<std::string, size_t>					mFontKeyIndex;
+	//! Space separated tokens of the font keys mapped to the fonts whose keys have them, along with the token counts of the keys
+	std::unordered_map<std::string, std::vector<size_t>>	mFontTokenIndex;
+	std::vector<size_t>										mFontKeyTokenCounts;
+	//! Names already resolved by getFontInfo(), lower case
+	std::unordered_map<std::string, FontInfo>				mResolvedFontInfos;
+	//! File the fonts are cataloged in between runs, empty if they aren't
+	fs::path						mCatalogPath;
+	//! Modification times of the font files and directories the catalog was built from, and its fonts. Kept while 
+	//! enumerating so that a rescan can reuse the fonts of unchanged files.
+	std::map<std::string, std::time_t>	mCatalogTimes;
+	std::vector<FontInfo>			mCatalogFontInfos;
 	std::set<FT_Face>				mTrackedFaces;
+	//! Faces of the font files that are loaded, by path
+	std::map<std::string, std::weak_ptr<FontFace>>	mFontFaces;
+	//! Content hash of each tracked face, computed once when the face is created
+	std::map<FT_Face, uint64_t>		mFaceHashes;
 	mutable SdfText::Font			mDefault;
 
 	SdfText::TextureAtlas::AtlasCacher		mTrackedTextureAtlases;
-
+	SdfText::TextureAtlas::AtlasIndex		mTextureAtlasIndex;
+	//! Pages shared by the atlases of every font, per texture size and tile spacing. They go away with the last atlas on them.
+	std::unordered_map<uint64_t, std::weak_ptr<SdfText::TextureAtlas::Pages>>	mSharedPages;
+	//! Atlases being built by a thread, others asking for them wait until they're cached
+	std::unordered_set<SdfText::TextureAtlas::CacheKey, SdfText::TextureAtlas::CacheKeyHash>	mBuildingTextureAtlases;
+	std::condition_variable_any				mTextureAtlasBuilt;
+	size_t									mTextureMemoryBudget = 128 * 1024 * 1024;
+	GlyphOutlineCache						mGlyphOutlines;
+	//! Futures of createAsync() kept until updateAsync() finds them ready
+	std::vector<SdfText::FutureRef>			mPendingFutures;
+
+	//! Enumerates the system fonts the first time they're needed, or again if \a forceRefresh is set
+	void							enumerateFonts( bool forceRefresh );
+	//! Rebuilds the indices getFontInfo() resolves names with
+	void							indexFonts();
 	void							acquireFontNamesAndPaths();
-	void							faceCreated( FT_Face face );
+#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+	//! Takes the fonts from the catalog, returns false if it's missing or anything it was built from changed
+	bool							readFontCatalog();
+	void							writeFontCatalog();
+#endif
+	//! Returns the face of the file behind \a dataSource if it's loaded already, otherwise loads it
+	FontFaceRef						getFontFace( const ci::DataSourceRef &dataSource );
+	//! Digests the font data of \a face, which is \a mapped from a file or in a buffer
+	void							faceCreated( FT_Face face, bool mapped );
 	void							faceDestroyed( FT_Face face );
 
-	SdfText::TextureAtlasRef		getTextureAtlas( FT_Face face, const SdfText::Format &format, const std::string &utf8Chars, const std::vector<SdfText::Font::Glyph> &glyphIndices );
+	//! With \a bakeAsync a new atlas starts generating its glyphs on a worker thread, otherwise the atlas is complete on return
+	SdfText::TextureAtlasRef		getTextureAtlas( const FontFaceRef &fontFace, const SdfText::Format &format, const std::string &utf8Chars, const std::vector<SdfText::Font::Glyph> &glyphIndices, bool bakeAsync );
 
 	friend class SdfText;
 	friend class SdfText::FontData;
+	friend class FontFace;
 	friend bool SdfTextFontManager_destroyStaticInstance();
 };
 
@@ -530,8 +1602,15 @@ public:
 	SdfText::Alignment		getAlignment() const { return mAlign; }
 	void					setAlignment( SdfText::Alignment align ) { mAlign = align; mInvalid = true; }
 
-	std::vector<std::string>			calculateLineBreaks() const;
+	//! Scratch space of layouts, reused across the layouts of a batch
+	struct LayoutBuffers;
+
+	//! Breaks the text into \a buffers->mLines
+	void								calculateLineBreaks( LayoutBuffers *buffers ) const;
 	SdfText::Font::GlyphMeasuresList	measureGlyphs( const SdfText::DrawOptions& drawOptions ) const;
+	//! Lays out the text into \a result like measureGlyphs(), without resolving its characters first. Once they're 
+	//! resolved it only reads the SdfText, so layouts with buffers of their own may run on several threads.
+	void								measureGlyphs( const SdfText::DrawOptions& drawOptions, LayoutBuffers *buffers, SdfText::Font::GlyphMeasuresList *result ) const;
 
 private:
 	const SdfText		*mSdfText = nullptr;
@@ -547,9 +1626,11 @@ private:
 // SdfTexttManager Implementation
 // =================================================================================================
 SdfTextManager* SdfTextManager::sInstance = nullptr;
+static std::mutex sInstanceMutex;
 
 bool SdfTextFontManager_destroyStaticInstance() 
 {
+	std::lock_guard<std::mutex> lock( sInstanceMutex );
 	if( nullptr != SdfTextManager::sInstance ) {
 		delete SdfTextManager::sInstance;
 		SdfTextManager::sInstance = nullptr;
@@ -557,6 +1638,40 @@ bool SdfTextFontManager_destroyStaticInstance()
 	return true;
 }
 
+#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+//! Returns where the font catalog goes unless setCatalogPath() is called, empty if there's nowhere private to put it. 
+//! Android apps have a cache directory of their own, elsewhere it's the user's cache directory so that users don't 
+//! share, or plant, a catalog in the temporary directory.
+static fs::path defaultCatalogPath()
+{
+#if defined( CINDER_ANDROID )
+	return ci::getTemporaryDirectory() / "SdfTextFontCatalog.bin";
+#else
+	// XDG_CACHE_HOME has to be absolute to count
+	fs::path cacheDir;
+	const char *xdgCacheHome = std::getenv( "XDG_CACHE_HOME" );
+	if( ( nullptr != xdgCacheHome ) && ( '/' == xdgCacheHome[0] ) ) {
+		cacheDir = fs::path( xdgCacheHome );
+	}
+	else if( ! ci::getHomeDirectory().empty() ) {
+		cacheDir = ci::getHomeDirectory() / ".cache";
+	}
+	return cacheDir.empty() ? fs::path() : ( cacheDir / "cinder-sdftext" / "SdfTextFontCatalog.bin" );
+#endif
+}
+
+//! Returns the modification time of a file or directory, -1 if there's none
+static std::time_t fileTime( const fs::path &path )
+{
+	try {
+		return fs::exists( path ) ? static_cast<std::time_t>( fs::last_write_time( path ) ) : -1;
+	}
+	catch( const std::exception& ) {
+		return -1;
+	}
+}
+#endif
+
 SdfTextManager::SdfTextManager()
 {
 	FT_Error ftRes = FT_Init_FreeType( &mLibrary );
@@ -564,19 +1679,9 @@ SdfTextManager::SdfTextManager()
 		throw FontInvalidNameExc("Failed to initialize FreeType2");
 	}
 
-	acquireFontNamesAndPaths();
-#if defined( CINDER_MSW )
-	// Registry operations can be rejected by Windows so no fonts will be picked up 
-	// on the initial scan. So we can multiple times.
-	if( mFontInfos.empty() ) {
-		for( int i = 0; i < 5; ++i ) {
-			acquireFontNamesAndPaths();
-			if( ! mFontInfos.empty() ) {
-				break;
-			}
-			::Sleep( 10 );
-		}
-	}
+	// Fonts are enumerated on first use, apps that only load their own fonts never scan the system ones
+#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+	mCatalogPath = defaultCatalogPath();
 #endif
 }
 
@@ -598,6 +1703,7 @@ SdfTextManager::~SdfTextManager()
 
 SdfTextManager* SdfTextManager::instance()
 {
+	std::lock_guard<std::mutex> lock( sInstanceMutex );
 	if( nullptr == SdfTextManager::sInstance ) {
 		SdfTextManager::sInstance =  new SdfTextManager();
 		if( nullptr != SdfTextManager::sInstance ) {
@@ -768,6 +1874,18 @@ void SdfTextManager::acquireFontNamesAndPaths()
 			if( fs::is_regular_file( dir_iter->status() ) ) {
 				fs::path fontPath = dir_iter->path();
 
+				// Unchanged files take their fonts from the catalog instead of opening a face
+				auto catalogIt = mCatalogTimes.find( fontPath.string() );
+				if( ( mCatalogTimes.end() != catalogIt ) && ( fileTime( fontPath ) == catalogIt->second ) ) {
+					for( const auto& fontInfo : mCatalogFontInfos ) {
+						if( fontInfo.path == fontPath ) {
+							mFontInfos.push_back( fontInfo );
+						}
+					}
+					continue;
+				}
+
+				std::lock_guard<std::mutex> libraryLock( mLibraryMutex );
 				FT_Face tmpFace;
 				FT_Error error = FT_New_Face( mLibrary, fontPath.string().c_str(), 0, &tmpFace );
 				if( error ) {
@@ -873,85 +1991,443 @@ void SdfTextManager::acquireFontNamesAndPaths()
 			}			
 		}
 
-		::FcObjectSetDestroy( os );
-		::FcPatternDestroy( pat );
-		::FcFontSetDestroy( fs );
+		::FcObjectSetDestroy( os );
+		::FcPatternDestroy( pat );
+		::FcFontSetDestroy( fs );
+
+		::FcFini();
+	}
+}
+#endif
+
+#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+// Catalog layout: ident, version, then the times of the files and directories it was built from, the font infos 
+// and the font names, strings as a uint32 length followed by the bytes
+static const uint32_t kFontCatalogVersion = 0x00000002;
+
+static void writeCatalogString( const ci::OStreamRef &os, const std::string &str )
+{
+	const uint32_t length = static_cast<uint32_t>( str.length() );
+	os->writeLittle( length );
+	os->writeData( str.data(), length );
+}
+
+static std::string readCatalogString( const ci::IStreamRef &is )
+{
+	uint32_t length = 0;
+	is->readLittle( &length );
+	std::string result( length, '\0' );
+	is->readData( &result[0], length );
+	return result;
+}
+
+bool SdfTextManager::readFontCatalog()
+{
+	mCatalogTimes.clear();
+	mCatalogFontInfos.clear();
+	if( mCatalogPath.empty() || ( ! fs::exists( mCatalogPath ) ) ) {
+		return false;
+	}
+
+	std::vector<std::string> fontNames;
+	try {
+		ci::IStreamRef is = ci::loadFile( mCatalogPath )->createStream();
+
+		// File ident: SFCT
+		uint8_t ident[4];
+		is->readData( ident, 4 );
+		uint32_t version = 0;
+		is->readLittle( &version );
+		if( ( std::string( "SFCT" ) != std::string( reinterpret_cast<const char*>( ident ), 4 ) ) || ( kFontCatalogVersion != version ) ) {
+			return false;
+		}
+
+		uint32_t numTimes = 0;
+		is->readLittle( &numTimes );
+		for( uint32_t i = 0; i < numTimes; ++i ) {
+			std::string path = readCatalogString( is );
+			int64_t time = 0;
+			is->readLittle( &time );
+			mCatalogTimes[path] = static_cast<std::time_t>( time );
+		}
+
+		uint32_t numFontInfos = 0;
+		is->readLittle( &numFontInfos );
+		for( uint32_t i = 0; i < numFontInfos; ++i ) {
+			std::string key = readCatalogString( is );
+			std::string name = readCatalogString( is );
+			std::string path = readCatalogString( is );
+			mCatalogFontInfos.push_back( FontInfo( key, name, path ) );
+		}
+
+		uint32_t numFontNames = 0;
+		is->readLittle( &numFontNames );
+		for( uint32_t i = 0; i < numFontNames; ++i ) {
+			fontNames.push_back( readCatalogString( is ) );
+		}
+	}
+	catch( const std::exception& e ) {
+		CI_LOG_W( "SdfText: couldn't read the font catalog " << mCatalogPath << ": " << e.what() );
+		mCatalogTimes.clear();
+		mCatalogFontInfos.clear();
+		return false;
+	}
+
+	// Fonts added to or removed from a directory change its time too
+	for( const auto& elem : mCatalogTimes ) {
+		if( fileTime( elem.first ) != elem.second ) {
+			return false;
+		}
+	}
+
+	mFontInfos = mCatalogFontInfos;
+	mFontNames = fontNames;
+	return true;
+}
+
+void SdfTextManager::writeFontCatalog()
+{
+	if( mCatalogPath.empty() ) {
+		return;
+	}
+
+	// The directories the platform looks for fonts in
+#if defined( CINDER_ANDROID )
+	std::set<fs::path> fontDirs = { "/system/fonts" };
+	std::set<fs::path> dirs = fontDirs;
+#else
+	std::set<fs::path> fontDirs = { "/usr/share/fonts", "/usr/local/share/fonts", ci::getHomeDirectory() / ".fonts", ci::getHomeDirectory() / ".local/share/fonts" };
+	std::set<fs::path> dirs = fontDirs;
+	// fontconfig knows every directory it scans, subdirectories included. Its configuration says where fonts are and 
+	// its caches are rewritten by fc-cache once fonts are installed, so they're watched too.
+	if( ::FcInit() ) {
+		::FcConfig *config = ::FcConfigGetCurrent();
+		::FcStrList *fcFontDirs = ::FcConfigGetFontDirs( config );
+		for( ::FcChar8 *dir = ::FcStrListNext( fcFontDirs ); nullptr != dir; dir = ::FcStrListNext( fcFontDirs ) ) {
+			fontDirs.insert( fs::path( reinterpret_cast<const char*>( dir ) ) );
+			dirs.insert( fs::path( reinterpret_cast<const char*>( dir ) ) );
+		}
+		::FcStrListDone( fcFontDirs );
+
+		::FcStrList *fcConfigFiles = ::FcConfigGetConfigFiles( config );
+		for( ::FcChar8 *file = ::FcStrListNext( fcConfigFiles ); nullptr != file; file = ::FcStrListNext( fcConfigFiles ) ) {
+			dirs.insert( fs::path( reinterpret_cast<const char*>( file ) ) );
+			dirs.insert( fs::path( reinterpret_cast<const char*>( file ) ).parent_path() );
+		}
+		::FcStrListDone( fcConfigFiles );
+
+		::FcStrList *fcCacheDirs = ::FcConfigGetCacheDirs( config );
+		for( ::FcChar8 *dir = ::FcStrListNext( fcCacheDirs ); nullptr != dir; dir = ::FcStrListNext( fcCacheDirs ) ) {
+			dirs.insert( fs::path( reinterpret_cast<const char*>( dir ) ) );
+		}
+		::FcStrListDone( fcCacheDirs );
+
+		::FcFini();
+	}
+#endif
+
+	// Every directory between a font and the font directory it's in. A family installed into a new subdirectory only 
+	// changes the time of the subdirectory's parent, which may be a few levels below the font directory.
+	std::map<std::string, std::time_t> times;
+	for( const auto& fontInfo : mFontInfos ) {
+		times[fontInfo.path.string()] = fileTime( fontInfo.path );
+		std::vector<fs::path> fontPathDirs;
+		for( fs::path dir = fontInfo.path.parent_path(); ( ! dir.empty() ) && ( dir != dir.root_path() ); dir = dir.parent_path() ) {
+			fontPathDirs.push_back( dir );
+			if( fontDirs.end() != fontDirs.find( dir ) ) {
+				break;
+			}
+		}
+		// Fonts outside the font directories only add their own
+		if( ( ! fontPathDirs.empty() ) && ( fontDirs.end() == fontDirs.find( fontPathDirs.back() ) ) ) {
+			fontPathDirs.resize( 1 );
+		}
+		dirs.insert( fontPathDirs.begin(), fontPathDirs.end() );
+	}
+	for( const auto& dir : dirs ) {
+		times[dir.string()] = fileTime( dir );
+	}
+
+	// Written next to the catalog and moved over it, so other processes never read half of one
+	const fs::path tmpCatalogPath = mCatalogPath.string() + ".tmp";
+	try {
+		{
+			ci::OStreamRef os = ci::writeFile( tmpCatalogPath, true )->getStream();
+
+			// File ident: SFCT
+			os->write( static_cast<uint8_t>( 'S' ) );
+			os->write( static_cast<uint8_t>( 'F' ) );
+			os->write( static_cast<uint8_t>( 'C' ) );
+			os->write( static_cast<uint8_t>( 'T' ) );
+			os->writeLittle( kFontCatalogVersion );
+
+			os->writeLittle( static_cast<uint32_t>( times.size() ) );
+			for( const auto& elem : times ) {
+				writeCatalogString( os, elem.first );
+				os->writeLittle( static_cast<int64_t>( elem.second ) );
+			}
+
+			os->writeLittle( static_cast<uint32_t>( mFontInfos.size() ) );
+			for( const auto& fontInfo : mFontInfos ) {
+				writeCatalogString( os, fontInfo.key );
+				writeCatalogString( os, fontInfo.name );
+				writeCatalogString( os, fontInfo.path.string() );
+			}
+
+			os->writeLittle( static_cast<uint32_t>( mFontNames.size() ) );
+			for( const auto& fontName : mFontNames ) {
+				writeCatalogString( os, fontName );
+			}
+		}
+		fs::rename( tmpCatalogPath, mCatalogPath );
+	}
+	catch( const std::exception& e ) {
+		CI_LOG_W( "SdfText: couldn't write the font catalog " << mCatalogPath << ": " << e.what() );
+	}
+}
+#endif
+
+void SdfTextManager::enumerateFonts( bool forceRefresh )
+{
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	if( mFontsEnumerated && ( ! forceRefresh ) ) {
+		return;
+	}
+
+	mFontInfos.clear();
+	mFontNames.clear();
+
+#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+	// Warm starts take the fonts from the catalog, a stale one still spares the rescan the unchanged files
+	if( forceRefresh ) {
+		mCatalogTimes.clear();
+		mCatalogFontInfos.clear();
+	}
+	else if( readFontCatalog() ) {
+		mCatalogTimes.clear();
+		mCatalogFontInfos.clear();
+		indexFonts();
+		mFontsEnumerated = true;
+		return;
+	}
+#endif
+
+	acquireFontNamesAndPaths();
+#if defined( CINDER_MSW )
+	// Registry operations can be rejected by Windows so no fonts will be picked up 
+	// on the initial scan. So we can multiple times.
+	if( mFontInfos.empty() ) {
+		for( int i = 0; i < 5; ++i ) {
+			acquireFontNamesAndPaths();
+			if( ! mFontInfos.empty() ) {
+				break;
+			}
+			::Sleep( 10 );
+		}
+	}
+#endif
+
+	indexFonts();
+	mFontsEnumerated = true;
 
-		::FcFini();
+#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+	writeFontCatalog();
+	mCatalogTimes.clear();
+	mCatalogFontInfos.clear();
+#endif
+}
+
+void SdfTextManager::indexFonts()
+{
+	mFontKeyIndex.clear();
+	mFontTokenIndex.clear();
+	mFontKeyTokenCounts.clear();
+	mResolvedFontInfos.clear();
+
+	for( size_t fontIndex = 0; fontIndex < mFontInfos.size(); ++fontIndex ) {
+		const std::string &key = mFontInfos[fontIndex].key;
+		mFontKeyIndex.insert( std::make_pair( key, fontIndex ) );
+
+		std::vector<std::string> keyTokens = ci::split( key, ' ' );
+		mFontKeyTokenCounts.push_back( keyTokens.size() );
+		for( const auto& tok : keyTokens ) {
+			std::vector<size_t> &fontIndices = mFontTokenIndex[tok];
+			if( fontIndices.empty() || ( fontIndex != fontIndices.back() ) ) {
+				fontIndices.push_back( fontIndex );
+			}
+		}
 	}
 }
-#endif
 
-void SdfTextManager::faceCreated( FT_Face face ) 
+FT_Face SdfTextManager::newFace( const FT_Byte *data, FT_Long size )
 {
+	std::lock_guard<std::mutex> lock( mLibraryMutex );
+	FT_Face face = nullptr;
+	if( FT_Err_Ok != FT_New_Memory_Face( mLibrary, data, size, 0, &face ) ) {
+		return nullptr;
+	}
+
+	FT_Select_Charmap( face, FT_ENCODING_UNICODE );
 	mTrackedFaces.insert( face );
+	return face;
+}
+
+void SdfTextManager::doneFace( FT_Face face )
+{
+	// Faces left over from a manager that's been destroyed are gone already
+	std::lock_guard<std::mutex> lock( mLibraryMutex );
+	if( 0 != mTrackedFaces.erase( face ) ) {
+		FT_Done_Face( face );
+	}
+}
+
+void SdfTextManager::faceCreated( FT_Face face, bool mapped ) 
+{
+	// Faces are loaded from memory, so the font file is hashed directly. Identical files 
+	// loaded through different data sources share their atlases. Hashing all of a mapped 
+	// file would page it in, its table directory identifies it well enough.
+	uint64_t hash = hashBytes( &face->face_index, sizeof( face->face_index ) );
+	uint64_t sfntHash = hash;
+	if( ( nullptr != face->stream ) && ( nullptr != face->stream->base ) && mapped && hashSfntDirectory( face->stream->base, static_cast<size_t>( face->stream->size ), face->face_index, &sfntHash ) ) {
+		hash = sfntHash;
+	}
+	else if( ( nullptr != face->stream ) && ( nullptr != face->stream->base ) ) {
+		hash = hashBytes( face->stream->base, static_cast<size_t>( face->stream->size ), hash );
+	}
+	else {
+		hash = hashBytes( face->family_name, std::strlen( face->family_name ), hash );
+		hash = hashBytes( face->style_name, std::strlen( face->style_name ), hash );
+	}
+
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	mFaceHashes[face] = hash;
 }
 
 void SdfTextManager::faceDestroyed( FT_Face face ) 
 {
-	mTrackedFaces.erase( face );
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	mFaceHashes.erase( face );
+	mGlyphOutlines.erase( face );
 }
 
-SdfText::TextureAtlasRef SdfTextManager::getTextureAtlas( FT_Face face, const SdfText::Format &format, const std::string &utf8Chars, const std::vector<SdfText::Font::Glyph> &glyphIndices )
+SdfText::TextureAtlasRef SdfTextManager::getTextureAtlas( const FontFaceRef &fontFace, const SdfText::Format &format, const std::string &utf8Chars, const std::vector<SdfText::Font::Glyph> &glyphIndices, bool bakeAsync )
 {
+	// The character set digest doesn't depend on the order or repetition of the characters
 	std::u32string utf32Chars = ci::toUtf32( utf8Chars );
-	// Add a space if needed
-	if( std::string::npos == utf8Chars.find( ' ' ) ) {
-		utf32Chars += ci::toUtf32( " " );
-	}
+	utf32Chars += U' ';
+	std::sort( std::begin( utf32Chars ), std::end( utf32Chars ) );
+	utf32Chars.erase( std::unique( std::begin( utf32Chars ), std::end( utf32Chars ) ), std::end( utf32Chars ) );
+
+	std::unique_lock<std::recursive_mutex> lock( mMutex );
 
-	// Build the maps and information pieces that will be needed later
-	vec2 maxGlyphSize = vec2( 0 );
-	for( const auto& ch : utf32Chars ) {
-		FT_UInt glyphIndex = FT_Get_Char_Index( face, static_cast<FT_ULong>( ch ) );
-		// Glyph bounds, 
-		msdfgen::Shape shape;
-		if( msdfgen::loadGlyph( shape, face, glyphIndex ) ) {
-			double l, b, r, t;
-			l = b = r = t = 0.0;
-			shape.bounds( l, b, r, t );
-			// Glyph bounds
-			Rectf bounds = Rectf( 
-				static_cast<float>( l ), 
-				static_cast<float>( b ), 
-				static_cast<float>( r ), 
-				static_cast<float>( t ) );
-			// Max glyph size
-			maxGlyphSize.x = std::max( maxGlyphSize.x, bounds.getWidth() );
-			maxGlyphSize.y = std::max( maxGlyphSize.y, bounds.getHeight() );
-		}	
-	}
-	
 	SdfText::TextureAtlas::CacheKey key;
-	key.mFamilyName = std::string( face->family_name );
-	key.mStyleName = std::string( face->style_name );
-	key.mUtf8Chars = utf8Chars;
-	key.mTextureSize = format.getTextureSize();
-	key.mSdfBitmapSize = SdfText::TextureAtlas::calculateSdfBitmapSize( format.getSdfScale(), format.getSdfPadding(), maxGlyphSize );
+	key.mFontHash = mFaceHashes.at( fontFace->getFace() );
+	key.mFormatHash = hashFormat( format );
+	key.mCharsHash = hashBytes( utf32Chars.data(), utf32Chars.size() * sizeof( char32_t ) );
+
+	// Another thread may be building the same atlas
+	mTextureAtlasBuilt.wait( lock, [this, &key]() { return mBuildingTextureAtlases.end() == mBuildingTextureAtlases.find( key ); } );
 
 	// Result
 	SdfText::TextureAtlasRef result;
-	// Look for the texture atlas 
-	auto it = std::find_if( std::begin( mTrackedTextureAtlases ), std::end( mTrackedTextureAtlases ),
-		[key]( const std::pair<SdfText::TextureAtlas::CacheKey, SdfText::TextureAtlasRef>& elem ) -> bool {
-			return elem.first == key;
+	// Use the texture atlas if a matching one is found, it becomes the most recently used
+	auto it = mTextureAtlasIndex.find( key );
+	if( mTextureAtlasIndex.end() != it ) {
+		result = it->second->second;
+		mTrackedTextureAtlases.splice( std::end( mTrackedTextureAtlases ), mTrackedTextureAtlases, it->second );
+		lock.unlock();
+		// The atlas may still be baking for createAsync()
+		if( ! bakeAsync ) {
+			result->finishBake( true );
 		}
-	);
-	// Use the texture atlas if a matching one is found
-	if( mTrackedTextureAtlases.end() != it ) {
-		result = it->second;
 	}
 	// ...otherwise build a new one
 	else {
-		result = SdfText::TextureAtlas::create( face, format, glyphIndices );
+		SdfText::TextureAtlas::PagesRef sharedPages;
+		if( format.getSharedPages() ) {
+			auto &pages = mSharedPages[hashPageFormat( format )];
+			sharedPages = pages.lock();
+			if( ! sharedPages ) {
+				sharedPages = SdfText::TextureAtlas::PagesRef( new SdfText::TextureAtlas::Pages() );
+				pages = sharedPages;
+			}
+		}
+
+		// Built without the lock so that atlases of other fonts build meanwhile
+		mBuildingTextureAtlases.insert( key );
+		lock.unlock();
+		try {
+			result = SdfText::TextureAtlas::create( fontFace, key.mFontHash, format, glyphIndices, mGlyphOutlines, sharedPages, bakeAsync );
+			if( bakeAsync ) {
+				result->bakeAsync();
+			}
+		}
+		catch( ... ) {
+			lock.lock();
+			mBuildingTextureAtlases.erase( key );
+			mTextureAtlasBuilt.notify_all();
+			throw;
+		}
+
+		lock.lock();
+		mBuildingTextureAtlases.erase( key );
+		mTextureAtlasBuilt.notify_all();
 		mTrackedTextureAtlases.push_back( std::make_pair( key, result ) );
+		mTextureAtlasIndex[key] = std::prev( std::end( mTrackedTextureAtlases ) );
+		// Releasing atlases releases textures, createAsync() trims once it's back on the GL thread
+		if( ! bakeAsync ) {
+			trimTextureAtlases();
+		}
 	}
 
 	return result;
 }
 
-SdfTextManager::FontInfo SdfTextManager::getFontInfo( const std::string& fontName ) const
+void SdfTextManager::setTextureMemoryBudget( size_t bytes )
+{
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	mTextureMemoryBudget = bytes;
+	trimTextureAtlases();
+}
+
+size_t SdfTextManager::getTextureMemoryUsage() const
+{
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	// Shared pages count once
+	size_t result = 0;
+	std::set<const SdfText::TextureAtlas::Pages *> countedPages;
+	for( const auto& elem : mTrackedTextureAtlases ) {
+		if( countedPages.insert( elem.second->getPages().get() ).second ) {
+			result += elem.second->calculateTextureMemory();
+		}
+	}
+	return result;
+}
+
+void SdfTextManager::trimTextureAtlases()
+{
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	size_t usage = getTextureMemoryUsage();
+	for( auto it = std::begin( mTrackedTextureAtlases ); ( usage > mTextureMemoryBudget ) && ( std::end( mTrackedTextureAtlases ) != it ); ) {
+		// Atlases in use stay, the manager holds the only reference to the others. Atlases whose tiles are all used 
+		// by other atlases on the same shared pages stay too, releasing them wouldn't free anything.
+		if( ( 1 == it->second.use_count() ) && it->second->hasExclusiveTiles() ) {
+			mTextureAtlasIndex.erase( it->first );
+			it = mTrackedTextureAtlases.erase( it );
+			// Shared pages shrink as their last pages run empty
+			usage = getTextureMemoryUsage();
+		}
+		else {
+			++it;
+		}
+	}
+}
+
+SdfTextManager::FontInfo SdfTextManager::getFontInfo( const std::string& fontName )
 {
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	enumerateFonts( false );
+
 	SdfTextManager::FontInfo result;
 
 #if defined( CINDER_MAC )
@@ -969,66 +2445,58 @@ SdfTextManager::FontInfo SdfTextManager::getFontInfo( const std::string& fontNam
 	std::string lcfn = boost::to_lower_copy( fontName );
 	boost::trim( lcfn );
 
-	auto it = std::find_if( std::begin( mFontInfos ), std::end( mFontInfos ),
-		[lcfn]( const SdfTextManager::FontInfo &elem ) -> bool {
-			return elem.key == lcfn;
-		}
-	);
+	auto resolvedIt = mResolvedFontInfos.find( lcfn );
+	if( mResolvedFontInfos.end() != resolvedIt ) {
+		return resolvedIt->second;
+	}
 
-	if( std::end( mFontInfos ) != it ) {
-		result = *it;
+	auto keyIt = mFontKeyIndex.find( lcfn );
+	if( mFontKeyIndex.end() != keyIt ) {
+		result = mFontInfos[keyIt->second];
 	}
 	else {
+		// A token without spaces is in a key only if it's in one of the key's tokens, so the fonts that score come 
+		// from the token index. Ordered by font so that ties go to the first font, like a scan over all of them would.
 		std::vector<std::string> tokens = ci::split( lcfn, ' ' );
-		float highScore = 0.0f;
-		for( const auto& fontInfos : mFontInfos ) {
-			int hits = 0;
-			for( const auto& tok : tokens ) {
-				if( std::string::npos != fontInfos.key.find( tok ) ) {
-					hits += static_cast<int>( tok.size() );	
-				}
+		std::map<size_t, int> fontHits;
+		for( const auto& tok : tokens ) {
+			if( tok.empty() ) {
+				continue;
 			}
 
-			if( hits > 0 ) {
-				std::vector<std::string> keyTokens = ci::split( fontInfos.key, ' ' );
-				float keyScore = ( keyTokens.size() == tokens.size() ) ? 0.25f : 0.0f;
-				float hitScore = static_cast<float>( hits ) / static_cast<float>( fontInfos.key.length() - ( keyTokens.size() - 1 ) );
-				hitScore = 0.75f * std::min( hitScore, 1.0f );
-				float totalScore = keyScore + hitScore;
-				if( totalScore > highScore ) {
-					highScore = totalScore;
-					result = fontInfos;
+			std::set<size_t> tokFontIndices;
+			for( const auto& elem : mFontTokenIndex ) {
+				if( std::string::npos != elem.first.find( tok ) ) {
+					tokFontIndices.insert( std::begin( elem.second ), std::end( elem.second ) );
 				}
 			}
+			for( const auto& fontIndex : tokFontIndices ) {
+				fontHits[fontIndex] += static_cast<int>( tok.size() );
+			}
+		}
+
+		float highScore = 0.0f;
+		for( const auto& elem : fontHits ) {
+			const SdfTextManager::FontInfo &fontInfo = mFontInfos[elem.first];
+			const size_t numKeyTokens = mFontKeyTokenCounts[elem.first];
+			float keyScore = ( numKeyTokens == tokens.size() ) ? 0.25f : 0.0f;
+			float hitScore = static_cast<float>( elem.second ) / static_cast<float>( fontInfo.key.length() - ( numKeyTokens - 1 ) );
+			hitScore = 0.75f * std::min( hitScore, 1.0f );
+			float totalScore = keyScore + hitScore;
+			if( totalScore > highScore ) {
+				highScore = totalScore;
+				result = fontInfo;
+			}
 		}
 	}
 
+	mResolvedFontInfos[lcfn] = result;
 	return result;
 }
 
 const std::vector<std::string>& SdfTextManager::getNames( bool forceRefresh )
 {
-	if( ( ! mFontsEnumerated ) || forceRefresh ) {
-		mFontInfos.clear();
-		mFontNames.clear();
-
-		acquireFontNamesAndPaths();
-#if defined( CINDER_MSW )
-		// Registry operations can be rejected by Windows so no fonts will be picked up 
-		// on the initial scan. So we can multiple times.
-		if( mFontInfos.empty() ) {
-			for( int i = 0; i < 5; ++i ) {
-				acquireFontNamesAndPaths();
-				if( ! mFontInfos.empty() ) {
-					break;
-				}
-				::Sleep( 10 );
-			}
-		}
-#endif        
-
-		mFontsEnumerated = true;
-	}
+	enumerateFonts( forceRefresh );
 
 /*
 	if( ( ! mFontsEnumerated ) || forceRefresh ) {
@@ -1107,6 +2575,7 @@ const std::vector<std::string>& SdfTextManager::getNames( bool forceRefresh )
 
 SdfText::Font SdfTextManager::getDefault() const
 {
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
 	if( ! mDefault ) {
 #if defined( CINDER_COCOA )        
 		mDefault = SdfText::Font( "Helvetica", 32.0f );
@@ -1123,80 +2592,178 @@ SdfText::Font SdfTextManager::getDefault() const
 // =================================================================================================
 // SdfTextBox Implementation
 // =================================================================================================
-struct LineProcessor 
+//! Decodes the UTF-8 character at \a *pos and moves \a *pos past it. Malformed sequences decode to something 
+//! rather than failing, like the rest of the layout expects.
+static uint32_t nextUtf8Char( const std::string &utf8, size_t *pos )
 {
-	LineProcessor( std::vector<std::string> *strings ) : mStrings( strings ) {}
-	void operator()( const char *line, size_t len ) const { mStrings->push_back( std::string( line, len ) ); }
-	mutable std::vector<std::string> *mStrings = nullptr;
-};
+	const size_t numBytes = utf8.size();
+	const uint8_t lead = static_cast<uint8_t>( utf8[*pos] );
+	size_t numCharBytes = 1;
+	uint32_t ch = lead;
+	if( 0xF0 == ( lead & 0xF8 ) ) {
+		numCharBytes = 4;
+		ch = lead & 0x07;
+	}
+	else if( 0xE0 == ( lead & 0xF0 ) ) {
+		numCharBytes = 3;
+		ch = lead & 0x0F;
+	}
+	else if( 0xC0 == ( lead & 0xE0 ) ) {
+		numCharBytes = 2;
+		ch = lead & 0x1F;
+	}
+	numCharBytes = std::min( numCharBytes, numBytes - *pos );
+	for( size_t j = 1; j < numCharBytes; ++j ) {
+		ch = ( ch << 6 ) | ( static_cast<uint8_t>( utf8[*pos + j] ) & 0x3F );
+	}
+
+	*pos += numCharBytes;
+	return ch;
+}
 
-struct LineMeasure 
+//! Decodes \a line without its trailing whitespace into \a utf32Chars, reusing its storage
+static void decodeLine( const std::string &line, std::u32string *utf32Chars )
 {
-	LineMeasure( float maxWidth, const SdfText::Font::GlyphMetricsMap &cachedGlyphMetrics, const SdfText::Font::CharToGlyphMap& charToGlyphMap ) 
-		: mMaxWidth( maxWidth ), mCachedGlyphMetrics( cachedGlyphMetrics ), mCharToGlyphMap( charToGlyphMap ) {}
+	size_t numBytes = line.size();
+	while( ( numBytes > 0 ) && ( nullptr != std::strchr( " \t\n\v\f\r", line[numBytes - 1] ) ) ) {
+		--numBytes;
+	}
 
-	bool operator()( const char *line, size_t len ) const {
-		if( mMaxWidth >= MAX_SIZE ) {
-			// too big anyway so just return true
-			return true;
-		}
+	utf32Chars->clear();
+	for( size_t i = 0; i < numBytes; ) {
+		utf32Chars->push_back( static_cast<char32_t>( nextUtf8Char( line, &i ) ) );
+	}
+}
 
-		SdfText::Font::Glyph subGlyphIndex = 0;
-		// Use space for glyph substitution 
-		{
-			auto glyphIndexIt = mCharToGlyphMap.find( static_cast<uint32_t>( ' ' ) );
-			if( mCharToGlyphMap.end() != glyphIndexIt ) {
-				subGlyphIndex = glyphIndexIt->second;
-			}
+//! Breaks text into lines that fit a width in one pass. The text is decoded once into a prefix sum of the glyph 
+//! advances, so any run of characters is measured by a subtraction rather than by summing its advances again.
+//! \a advanceFn returns the advance of a character, including tracking. A LineBreaker may be reset() to break 
+//! other text, keeping its buffers.
+struct LineBreaker
+{
+	LineBreaker() {}
+
+	template <typename AdvanceFn>
+	LineBreaker( const std::string &utf8, const AdvanceFn &advanceFn ) {
+		reset( utf8, advanceFn );
+	}
+
+	template <typename AdvanceFn>
+	void reset( const std::string &utf8, const AdvanceFn &advanceFn ) {
+		mUtf8 = &utf8;
+
+		// Break opportunities after each byte
+		mBreaks.clear();
+		calcLinebreaksUtf8( utf8.c_str(), utf8.size(), &mBreaks );
+
+		const size_t numBytes = utf8.size();
+		mCharStarts.clear();
+		mPenX.clear();
+		mWhitespace.clear();
+		mCharStarts.reserve( numBytes + 1 );
+		mPenX.reserve( numBytes + 1 );
+		mWhitespace.reserve( numBytes );
+		float penX = 0.0f;
+		for( size_t i = 0; i < numBytes; ) {
+			mCharStarts.push_back( i );
+			mPenX.push_back( penX );
+
+			const uint32_t ch = nextUtf8Char( utf8, &i );
+			mWhitespace.push_back( ( ' ' == ch ) || ( '\t' == ch ) || ( '\n' == ch ) || ( '\r' == ch ) );
+			penX += advanceFn( static_cast<SdfText::Font::Char>( ch ) );
 		}
+		mCharStarts.push_back( numBytes );
+		mPenX.push_back( penX );
+	}
 
-		std::u32string utf32Chars = ci::toUtf32( std::string( line, len ) );
-		float measuredWidth = 0;
-		vec2 pen = { 0, 0 };
-		for( const auto& ch : utf32Chars ) {
-			auto glyphIndexIt = mCharToGlyphMap.find( static_cast<uint32_t>( ch ) );
-			if( mCharToGlyphMap.end() == glyphIndexIt ) {
-				continue;
+	//! Breaks the text into \a lines, each ending at a break opportunity unless a single word is wider than \a maxWidth. 
+	//! Trailing whitespace doesn't count towards the width of a line, measureGlyphs() trims it. The strings already in 
+	//! \a lines are reused.
+	void operator()( float maxWidth, std::vector<std::string> *lines ) const {
+		size_t numLines = 0;
+		const size_t numChars = mWhitespace.size();
+		size_t lineStart = 0;
+		while( lineStart < numChars ) {
+			// End of the last break opportunity that fits, if any
+			size_t lineEnd = lineStart;
+			size_t i = lineStart;
+			for( ; i < numChars; ++i ) {
+				if( ( ! mWhitespace[i] ) && ( ( mPenX[i + 1] - mPenX[lineStart] ) > maxWidth ) ) {
+					break;
+				}
+
+				const uint8_t brk = mBreaks[mCharStarts[i + 1] - 1];
+				if( ( UNICODE_ALLOW_BREAK == brk ) || ( UNICODE_MUST_BREAK == brk ) ) {
+					lineEnd = i + 1;
+					if( UNICODE_MUST_BREAK == brk ) {
+						break;
+					}
+				}
 			}
 
-			SdfText::Font::Glyph glyphIndex = glyphIndexIt->second;
-			auto glyphMetricIt = mCachedGlyphMetrics.find( glyphIndex );
-			if( mCachedGlyphMetrics.end() == glyphMetricIt ) {
-				continue;
+			// The whole rest fits, or nothing up to a break opportunity does and the word is split
+			if( numChars == i ) {
+				lineEnd = numChars;
+			}
+			else if( lineStart == lineEnd ) {
+				lineEnd = std::max( i, lineStart + 1 );
 			}
 
-			const vec2& advance = glyphMetricIt->second.advance;		
-			pen.x += advance.x;
-			pen.y += advance.y;
-			measuredWidth = pen.x;
+			if( lines->size() == numLines ) {
+				lines->emplace_back();
+			}
+			( *lines )[numLines++].assign( *mUtf8, mCharStarts[lineStart], mCharStarts[lineEnd] - mCharStarts[lineStart] );
+			lineStart = lineEnd;
 		}
-
-		bool result = ( measuredWidth <= mMaxWidth );
-		return result;
+		lines->resize( numLines );
 	}
 
-	float									mMaxWidth = 0;
-	const SdfText::Font::GlyphMetricsMap	&mCachedGlyphMetrics;
-	const SdfText::Font::CharToGlyphMap		&mCharToGlyphMap;
+	const std::string		*mUtf8 = nullptr;
+	std::vector<uint8_t>	mBreaks;
+	//! Byte offset of each character, plus the end of the text
+	std::vector<size_t>		mCharStarts;
+	//! Pen position before each character, plus the end of the text
+	std::vector<float>		mPenX;
+	std::vector<bool>		mWhitespace;
 };
 
-std::vector<std::string> SdfTextBox::calculateLineBreaks() const
-{
-	const auto& charToGlyph = mSdfText->getCharToGlyph();
-	const auto& glyphMetrics = mSdfText->getGlyphMetrics();
+struct SdfTextBox::LayoutBuffers {
+	LineBreaker					mLineBreaker;
+	std::vector<std::string>	mLines;
+	std::u32string				mUtf32Chars;
+	std::u32string				mNextUtf32Chars;
+};
 
-	std::vector<std::string> result;
-	std::function<void(const char *,size_t)> lineFn = LineProcessor( &result );		
-	lineBreakUtf8( mText.c_str(), LineMeasure( ( mSize.x > 0 ) ? static_cast<float>( mSize.x ) : MAX_SIZE, glyphMetrics, charToGlyph ), lineFn );
-	return result;
+void SdfTextBox::calculateLineBreaks( LayoutBuffers *buffers ) const
+{
+	const SdfText *sdfText = mSdfText;
+	const float tracking = ( mTracking * sdfText->getFont().getSize() ) / 1000.0f;
+	// Characters without a glyph don't move the pen, like in measureGlyphs()
+	buffers->mLineBreaker.reset( mText, [sdfText, tracking]( SdfText::Font::Char ch ) -> float {
+		const uint32_t glyphId = sdfText->findGlyphId( ch );
+		return ( INVALID_GLYPH_ID != glyphId ) ? sdfText->mGlyphRecords[glyphId].mMetrics.advance.x + tracking : 0.0f;
+	} );
+	buffers->mLineBreaker( ( mSize.x > 0 ) ? static_cast<float>( mSize.x ) : MAX_SIZE, &buffers->mLines );
 }
 
 SdfText::Font::GlyphMeasuresList SdfTextBox::measureGlyphs( const SdfText::DrawOptions& drawOptions ) const
 {
+	// Dynamic atlases pick up unseen characters here
+	mSdfText->resolveChars( mText );
+
 	SdfText::Font::GlyphMeasuresList result;
+	LayoutBuffers buffers;
+	measureGlyphs( drawOptions, &buffers, &result );
+	return result;
+}
+
+void SdfTextBox::measureGlyphs( const SdfText::DrawOptions& drawOptions, LayoutBuffers *buffers, SdfText::Font::GlyphMeasuresList *resultOut ) const
+{
+	SdfText::Font::GlyphMeasuresList &result = *resultOut;
+	result.clear();
 
 	if( mText.empty() ) {
-		return result;
+		return;
 	}
 
 	const auto& font = mSdfText->getFont();
@@ -1209,28 +2776,31 @@ SdfText::Font::GlyphMeasuresList SdfTextBox::measureGlyphs( const SdfText::DrawO
 	const float lineHeight    = ( leading != leading ) ? drawScale * 1.20f * font.getSize() : drawScale * leading; // Leading will be NaN if not defined.
 
 	// Calculate the line breaks
-	std::vector<std::string> mLines = calculateLineBreaks();
+	calculateLineBreaks( buffers );
+	const std::vector<std::string> &mLines = buffers->mLines;
 	if( mLines.empty() ) {
-		return result;
+		return;
 	}
 
 	// Build measures
-	const auto& charToGlyph = mSdfText->getCharToGlyph();
-	const auto& glyphMetrics = mSdfText->getGlyphMetrics();
-	std::u32string utf32Chars, nextUtf32Chars;
+	const auto& glyphRecords = mSdfText->mGlyphRecords;
+	const float tracking = ( mTracking * font.getSize() ) / 1000.0f; // See: https://graphicdesign.stackexchange.com/a/61079 
+	std::u32string &utf32Chars = buffers->mUtf32Chars;
+	std::u32string &nextUtf32Chars = buffers->mNextUtf32Chars;
+	nextUtf32Chars.clear();
 	float curY = 0;
 
 	for( std::vector<std::string>::const_iterator lineIt = mLines.begin(); lineIt != mLines.end(); ++lineIt ) {
 		// Fetch current line and prefetch next. This way we can look ahead.
 		if( nextUtf32Chars.empty() ) {
-			utf32Chars = ci::toUtf32( boost::algorithm::trim_right_copy( *lineIt ) );
+			decodeLine( *lineIt, &utf32Chars );
 		}
 		else {
 			std::swap( utf32Chars, nextUtf32Chars );
 		}
 
 		if( ( lineIt + 1 ) != mLines.end() ) {
-			nextUtf32Chars = ci::toUtf32( boost::algorithm::trim_right_copy( *( lineIt + 1 ) ) );
+			decodeLine( *( lineIt + 1 ), &nextUtf32Chars );
 		}
 		else {
 			nextUtf32Chars.clear();
@@ -1247,76 +2817,237 @@ SdfText::Font::GlyphMeasuresList SdfTextBox::measureGlyphs( const SdfText::DrawO
 
 		vec2 pen = { 0, 0 };
 		for( const auto& ch : utf32Chars ) {
-			auto glyphIndexIt = charToGlyph.find( static_cast<uint32_t>( ch ) );
-			if( charToGlyph.end() == glyphIndexIt ) {
+			const uint32_t glyphId = mSdfText->findGlyphId( static_cast<SdfText::Font::Char>( ch ) );
+			if( INVALID_GLYPH_ID == glyphId ) {
 				continue;
 			}
 			 
-			glyphIndex = glyphIndexIt->second;
-			auto glyphMetricIt = glyphMetrics.find( glyphIndex );
-			if( glyphMetrics.end() == glyphMetricIt ) {
-				continue;
+			const auto &glyphRecord = glyphRecords[glyphId];
+			glyphIndex = glyphRecord.mGlyph;
+			advance = glyphRecord.mMetrics.advance + tracking;
+			adjust = advance - glyphRecord.mMetrics.maximum;
+
+			glyphCount++;
+			if( ch == 32 ) {
+				spaceCount++;
+				spaceIndex = glyphIndex;
+			}
+
+			float xPos = pen.x;
+			result.push_back( std::make_pair( (uint32_t)glyphIndex, vec2( xPos, curY ) ) );
+
+			pen += advance;
+		}
+
+		// Apply alignment as a post-process.
+		bool aligned = false;
+		if( drawOptions.getJustify() ) {
+			const bool isLastLine = nextUtf32Chars.empty();
+			if( spaceCount > 0 && !isLastLine ) {
+				float space = ( mSize.x - ( pen.x + advance.x - adjust.x ) );
+				float offset = 0.0f;
+				for( size_t i = index; i < result.size(); ++i ) {
+					result[i].second.x += offset;
+					// 75% of the extra spacing comes from adjusting every character.
+					offset += ( 0.75f * space ) / glyphCount;
+					if( result[i].first == spaceIndex ) {
+						// 25% of the extra spacing comes from adjusting white space characters only.
+						offset += ( 0.25f * space ) / spaceCount;
+					}
+				}
+				aligned = true;
+			}
+		}
+
+		if( ! aligned ) {
+			switch( align ) {
+			case SdfText::LEFT:
+			break;
+			case SdfText::CENTER: {
+				float width = pen.x;
+				float offset = ( mSize.x - width ) * 0.5f;
+				for( size_t i = index; i < result.size(); ++i )
+					result[i].second.x += offset;
+			}
+			break;
+			case SdfText::RIGHT: {
+				float width = pen.x;
+				float offset = mSize.x - width;
+				for( size_t i = index; i < result.size(); ++i )
+					result[i].second.x += offset;
 			}
+			break;
+			}
+		}
+
+		curY += lineHeight;
+	}
+}
+
+// =================================================================================================
+// FontFace Implementation
+// =================================================================================================
+FontFace::FontFace( const ci::DataSourceRef &dataSource )
+{
+	if( dataSource->isFilePath() && mapFile( dataSource->getFilePath() ) ) {
+		mData = reinterpret_cast<const FT_Byte*>( mMappedData );
+		mDataSize = static_cast<FT_Long>( mMappedSize );
+	}
+	else {
+		mFileData = dataSource->getBuffer();
+		if( ! mFileData ) {
+			throw std::runtime_error("Failed to load font data");
+		}
+		mData = reinterpret_cast<const FT_Byte*>( mFileData->getData() );
+		mDataSize = static_cast<FT_Long>( mFileData->getSize() );
+	}
+
+	auto fontManager = SdfTextManager::instance();
+	mFace = fontManager->newFace( mData, mDataSize );
+	if( nullptr == mFace ) {
+		unmapFile();
+		throw std::runtime_error("Failed to load font data");
+	}
+	mPoolFaces.push_back( mFace );
+	mIdleFaces.push_back( mFace );
+
+	fontManager->faceCreated( mFace, nullptr != mMappedData );
+}
+
+FontFace::~FontFace()
+{
+	auto fontManager = SdfTextManager::instance();
+	if( nullptr != fontManager ) {
+		if( nullptr != mFace ) {
+			fontManager->faceDestroyed( mFace );
+		}
+		for( const auto& face : mPoolFaces ) {
+			fontManager->doneFace( face );
+		}
+	}
+
+	unmapFile();
+}
+
+FontFace::FaceLease FontFace::acquire()
+{
+	{
+		std::lock_guard<std::mutex> lock( mPoolMutex );
+		if( ! mIdleFaces.empty() ) {
+			FT_Face face = mIdleFaces.back();
+			mIdleFaces.pop_back();
+			return FaceLease( this, face );
+		}
+	}
+
+	FT_Face face = SdfTextManager::instance()->newFace( mData, mDataSize );
+	if( nullptr == face ) {
+		throw std::runtime_error("Failed to load font data");
+	}
+
+	std::lock_guard<std::mutex> lock( mPoolMutex );
+	mPoolFaces.push_back( face );
+	return FaceLease( this, face );
+}
+
+void FontFace::release( FT_Face face )
+{
+	std::lock_guard<std::mutex> lock( mPoolMutex );
+	mIdleFaces.push_back( face );
+}
 
-			advance = glyphMetricIt->second.advance + ( mTracking * font.getSize() ) / 1000.0f; // See: https://graphicdesign.stackexchange.com/a/61079 
-			adjust = advance - glyphMetricIt->second.maximum;
+void FontFace::unmapFile()
+{
+	if( nullptr != mMappedData ) {
+#if defined( CINDER_MSW )
+		::UnmapViewOfFile( mMappedData );
+#elif ! defined( CINDER_WINRT )
+		::munmap( const_cast<uint8_t *>( mMappedData ), mMappedSize );
+#endif
+		mMappedData = nullptr;
+	}
+}
+
+bool FontFace::mapFile( const fs::path &path )
+{
+#if defined( CINDER_WINRT )
+	return false;
+#elif defined( CINDER_MSW )
+	HANDLE file = ::CreateFileW( path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+	if( INVALID_HANDLE_VALUE == file ) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize = {};
+	if( ( ! ::GetFileSizeEx( file, &fileSize ) ) || ( fileSize.QuadPart <= 0 ) ) {
+		::CloseHandle( file );
+		return false;
+	}
+
+	// The view keeps the mapping and the file open
+	HANDLE mapping = ::CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+	::CloseHandle( file );
+	if( nullptr == mapping ) {
+		return false;
+	}
+	void *data = ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+	::CloseHandle( mapping );
+	if( nullptr == data ) {
+		return false;
+	}
+
+	mMappedData = static_cast<const uint8_t *>( data );
+	mMappedSize = static_cast<size_t>( fileSize.QuadPart );
+	return true;
+#else
+	int fd = ::open( path.string().c_str(), O_RDONLY );
+	if( fd < 0 ) {
+		return false;
+	}
 
-			glyphCount++;
-			if( ch == 32 ) {
-				spaceCount++;
-				spaceIndex = glyphIndex;
-			}
+	struct stat fileStat = {};
+	if( ( 0 != ::fstat( fd, &fileStat ) ) || ( fileStat.st_size <= 0 ) ) {
+		::close( fd );
+		return false;
+	}
 
-			float xPos = pen.x;
-			result.push_back( std::make_pair( (uint32_t)glyphIndex, vec2( xPos, curY ) ) );
+	// The mapping keeps the file open
+	void *data = ::mmap( nullptr, static_cast<size_t>( fileStat.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+	::close( fd );
+	if( MAP_FAILED == data ) {
+		return false;
+	}
 
-			pen += advance;
-		}
+	mMappedData = static_cast<const uint8_t *>( data );
+	mMappedSize = static_cast<size_t>( fileStat.st_size );
+	return true;
+#endif
+}
 
-		// Apply alignment as a post-process.
-		bool aligned = false;
-		if( drawOptions.getJustify() ) {
-			const bool isLastLine = nextUtf32Chars.empty();
-			if( spaceCount > 0 && !isLastLine ) {
-				float space = ( mSize.x - ( pen.x + advance.x - adjust.x ) );
-				float offset = 0.0f;
-				for( size_t i = index; i < result.size(); ++i ) {
-					result[i].second.x += offset;
-					// 75% of the extra spacing comes from adjusting every character.
-					offset += ( 0.75f * space ) / glyphCount;
-					if( result[i].first == spaceIndex ) {
-						// 25% of the extra spacing comes from adjusting white space characters only.
-						offset += ( 0.25f * space ) / spaceCount;
-					}
-				}
-				aligned = true;
-			}
-		}
+FontFaceRef SdfTextManager::getFontFace( const ci::DataSourceRef &dataSource )
+{
+	// Only files can be told apart up front, other data sources get faces of their own
+	if( ! dataSource->isFilePath() ) {
+		return FontFaceRef( new FontFace( dataSource ) );
+	}
 
-		if( ! aligned ) {
-			switch( align ) {
-			case SdfText::LEFT:
-			break;
-			case SdfText::CENTER: {
-				float width = pen.x;
-				float offset = ( mSize.x - width ) * 0.5f;
-				for( size_t i = index; i < result.size(); ++i )
-					result[i].second.x += offset;
-			}
-			break;
-			case SdfText::RIGHT: {
-				float width = pen.x;
-				float offset = mSize.x - width;
-				for( size_t i = index; i < result.size(); ++i )
-					result[i].second.x += offset;
-			}
-			break;
-			}
+	const std::string key = fs::absolute( dataSource->getFilePath() ).string();
+	{
+		std::lock_guard<std::recursive_mutex> lock( mMutex );
+		FontFaceRef result = mFontFaces[key].lock();
+		if( result ) {
+			return result;
 		}
-
-		curY += lineHeight;
 	}
 
+	// Loaded without the lock so that other fonts load meanwhile, if another thread loaded the same file first its face wins
+	FontFaceRef result = FontFaceRef( new FontFace( dataSource ) );
+	std::lock_guard<std::recursive_mutex> lock( mMutex );
+	std::weak_ptr<FontFace> &fontFace = mFontFaces[key];
+	if( FontFaceRef loaded = fontFace.lock() ) {
+		return loaded;
+	}
+	fontFace = result;
 	return result;
 }
 
@@ -1330,35 +3061,13 @@ public:
 			return;
 		}
 
-		mFileData = dataSource->getBuffer();
-		if( ! mFileData ) {
-			return;
-		}
-
 		auto fontManager = SdfTextManager::instance();
 		if( nullptr != fontManager ) {
-			FT_Error ftRes = FT_New_Memory_Face(
-				fontManager->getLibrary(),
-				reinterpret_cast<FT_Byte*>( mFileData->getData() ),
-				static_cast<FT_Long>( mFileData->getSize() ),
-				0,
-				&mFace
-			);
-
-			if( FT_Err_Ok != ftRes ) {
-				throw std::runtime_error("Failed to load font data");
-			}
-
-			fontManager->faceCreated( mFace );
+			mFontFace = fontManager->getFontFace( dataSource );
 		}
 	}
 
-	virtual ~FontData() {
-		auto fontManager = SdfTextManager::instance();
-		if( ( nullptr != fontManager ) && ( nullptr != mFace ) ) {
-			fontManager->faceDestroyed( mFace );
-		}
-	}
+	virtual ~FontData() {}
 
 	static SdfText::FontDataRef create( const ci::DataSourceRef &dataSource ) {
 		SdfText::FontDataRef result = SdfText::FontDataRef( new SdfText::FontData( dataSource ) );
@@ -1366,12 +3075,16 @@ public:
 	}
 
 	FT_Face	getFace() const {
-		return mFace;
+		return mFontFace ? mFontFace->getFace() : nullptr;
+	}
+
+	//! The face is shared with fonts of other sizes, glyph loads go through a lease of its pool
+	const FontFaceRef& getFontFace() const {
+		return mFontFace;
 	}
 
 private:
-	ci::BufferRef	mFileData;
-	FT_Face			mFace = nullptr;
+	FontFaceRef		mFontFace;
 };
 
 // =================================================================================================
@@ -1411,15 +3124,12 @@ SdfText::Font::~Font()
 void SdfText::Font::loadFontData( const ci::DataSourceRef &dataSource )
 {
 	mData = SdfText::FontData::create( dataSource );
-	FT_Select_Charmap( mData->getFace(), FT_ENCODING_UNICODE );
-
-	FT_F26Dot6 finalSize = static_cast<FT_F26Dot6>( mSize * 64.0f );
-	FT_Set_Char_Size( mData->getFace(), 0, finalSize , 0, 72 );
 
 	// Extract the name if needed
 	if( mName.empty() ) {
+		FontFace::FaceLease face = mData->getFontFace()->acquire();
 		FT_SfntName sn = {};
-		if( FT_Err_Ok == FT_Get_Sfnt_Name( mData->getFace(), TT_NAME_ID_FULL_NAME, &sn ) ) {
+		if( FT_Err_Ok == FT_Get_Sfnt_Name( face.get(), TT_NAME_ID_FULL_NAME, &sn ) ) {
 			// If full name isn't available use family and style name
 			if( sn.string_len > 0  && ( 0 == sn.string[0] ) ) {
 				// Fallback to this name
@@ -1465,7 +3175,8 @@ SdfText::Font::Glyph SdfText::Font::getGlyphIndex( size_t idx ) const
 
 SdfText::Font::Glyph SdfText::Font::getGlyphChar( char utf8Char ) const
 {
-	FT_UInt glyphIndex = FT_Get_Char_Index( mData->getFace(), static_cast<FT_ULong>( utf8Char ) );
+	FontFace::FaceLease face = mData->getFontFace()->acquire();
+	FT_UInt glyphIndex = FT_Get_Char_Index( face.get(), static_cast<FT_ULong>( utf8Char ) );
 	return static_cast<SdfText::Font::Glyph>( glyphIndex );
 }
 
@@ -1474,9 +3185,10 @@ std::vector<SdfText::Font::Glyph> SdfText::Font::getGlyphs( const std::string &u
 	std::vector<SdfText::Font::Glyph> result;
 	// Convert to UTF32
 	std::u32string utf32Chars = ci::toUtf32( utf8Chars );
+	FontFace::FaceLease face = mData->getFontFace()->acquire();
 	// Build the maps and information pieces that will be needed later
 	for( const auto& ch : utf32Chars ) {
-		FT_UInt glyphIndex = FT_Get_Char_Index( mData->getFace(), static_cast<FT_ULong>( ch ) );
+		FT_UInt glyphIndex = FT_Get_Char_Index( face.get(), static_cast<FT_ULong>( ch ) );
 		result.push_back( static_cast<SdfText::Font::Glyph>( glyphIndex ) );
 	}
 	return result;
@@ -1497,15 +3209,125 @@ SdfText::Font SdfText::Font::getDefault()
 	return SdfTextManager::instance()->getDefault();
 }
 
+void SdfText::Font::setCatalogPath( const fs::path &path )
+{
+	SdfTextManager::instance()->setCatalogPath( path );
+}
+
+// =================================================================================================
+// SdfText::LayoutCache
+// =================================================================================================
+//! Glyph measures of the strings laid out last. A string's glyphs and their metrics don't change once it's been 
+//! laid out, dynamic atlases only add glyphs, so the layouts stay valid for the lifetime of the SdfText.
+class SdfText::LayoutCache {
+public:
+	LayoutCache( size_t capacity ) : mCapacity( capacity ) {}
+
+	//! Points at the laid out string, lookups compare the string itself so a hash collision can't return another 
+	//! string's glyphs. The string only has to outlive the call, the cache keeps a copy of its own.
+	struct Key {
+		uint64_t			mStrHash = 0;
+		uint64_t			mOptionsHash = 0;
+		const std::string	*mStr = nullptr;
+		bool operator==( const Key& rhs ) const { 
+			return ( mStrHash == rhs.mStrHash ) && ( mOptionsHash == rhs.mOptionsHash ) && ( *mStr == *rhs.mStr );
+		}
+	};
+
+	struct KeyHash {
+		size_t operator()( const Key& key ) const {
+			return static_cast<size_t>( key.mStrHash ^ ( key.mOptionsHash * 31 ) );
+		}
+	};
+
+	//! Returns the cached layout, or null if there's none. It becomes the most recently used.
+	const SdfText::Font::GlyphMeasuresList*	find( const Key &key );
+	//! Replaces the layout if the key is already cached. Either way it becomes the most recently used.
+	void									insert( const Key &key, const SdfText::Font::GlyphMeasuresList &glyphMeasures );
+	void									setCapacity( size_t capacity );
+	size_t									getCapacity() const { return mCapacity; }
+
+private:
+	struct Layout {
+		std::string						mStr;
+		//! Points at mStr, list nodes don't move
+		Key								mKey;
+		SdfText::Font::GlyphMeasuresList	mGlyphMeasures;
+	};
+
+	//! Least recently used first
+	typedef std::list<Layout> Layouts;
+
+	size_t										mCapacity = 0;
+	Layouts										mLayouts;
+	std::unordered_map<Key, Layouts::iterator, KeyHash>	mLayoutIndex;
+};
+
+const SdfText::Font::GlyphMeasuresList* SdfText::LayoutCache::find( const Key &key )
+{
+	auto it = mLayoutIndex.find( key );
+	if( mLayoutIndex.end() == it ) {
+		return nullptr;
+	}
+
+	mLayouts.splice( std::end( mLayouts ), mLayouts, it->second );
+	return &( it->second->mGlyphMeasures );
+}
+
+void SdfText::LayoutCache::insert( const Key &key, const SdfText::Font::GlyphMeasuresList &glyphMeasures )
+{
+	auto it = mLayoutIndex.find( key );
+	if( mLayoutIndex.end() != it ) {
+		it->second->mGlyphMeasures = glyphMeasures;
+		mLayouts.splice( std::end( mLayouts ), mLayouts, it->second );
+		return;
+	}
+
+	mLayouts.push_back( Layout() );
+	Layout &layout = mLayouts.back();
+	layout.mStr = *key.mStr;
+	layout.mKey = key;
+	layout.mKey.mStr = &layout.mStr;
+	layout.mGlyphMeasures = glyphMeasures;
+	mLayoutIndex[layout.mKey] = std::prev( std::end( mLayouts ) );
+	setCapacity( mCapacity );
+}
+
+void SdfText::LayoutCache::setCapacity( size_t capacity )
+{
+	mCapacity = capacity;
+	while( mLayouts.size() > mCapacity ) {
+		mLayoutIndex.erase( mLayouts.front().mKey );
+		mLayouts.pop_front();
+	}
+}
+
+// =================================================================================================
+// SdfText::PlacedGlyphs
+// =================================================================================================
+//! Quads of laid out glyphs relative to the baseline, grouped by texture, and their tight bounds. Drawing, 
+//! placing and measuring all start from this, so the glyph transforms are worked out once per layout.
+struct SdfText::PlacedGlyphs {
+	//! Grouped by texture, in layout order within a texture
+	std::vector<SdfText::CharPlacement>	mPlacements;
+	//! Index of each placement's glyph in the glyph measures, to look up per-glyph colors
+	std::vector<uint32_t>				mMeasureIndices;
+	//! The placements on texture \c i are [mTextureStarts[i], mTextureStarts[i + 1])
+	std::vector<uint32_t>				mTextureStarts;
+	//! Union of the glyph outlines, including glyphs whose texture isn't uploaded yet
+	Rectf								mBounds = Rectf( 0, 0, 0, 0 );
+};
+
 // =================================================================================================
 // SdfText
 // =================================================================================================
-SdfText::SdfText( const SdfText::Font &font, const Format &format, const std::string &utf8Chars, bool generateSdf )
+SdfText::SdfText( const SdfText::Font &font, const Format &format, const std::string &utf8Chars, bool generateSdf, bool bakeAsync )
 	: mFont( font ), mFormat( format )
 {
+	mLatinGlyphIds.fill( INVALID_GLYPH_ID );
+
 	if( generateSdf ) {
-		FT_Face face = font.getFace();
-		if( nullptr == face ) {
+		if( nullptr == font.getFace() ) {
 			throw std::runtime_error( "null font face" );
 		}
 
@@ -1518,41 +3340,41 @@ SdfText::SdfText( const SdfText::Font &font, const Format &format, const std::st
 
 		// Build char/glyph maps
 		std::vector<SdfText::Font::Glyph> glyphIndices;
-        for( const auto &ch : utf32Chars ) {
-            // Lookup glyph index based on char
-			SdfText::Font::Glyph glyphIndex = static_cast<SdfText::Font::Glyph>( FT_Get_Char_Index( face, static_cast<FT_ULong>( ch ) ) );
-
-			// Unique glyph
-			auto it = std::find_if( std::begin( glyphIndices ), std::end( glyphIndices ),
-				[glyphIndex]( const SdfText::Font::Glyph &elem ) -> bool {
-					return ( elem == glyphIndex );
+		{
+			// The atlas and the metrics below lease faces of their own
+			FontFace::FaceLease face = font.mData->getFontFace()->acquire();
+			for( const auto &ch : utf32Chars ) {
+				// Lookup glyph index based on char
+				SdfText::Font::Glyph glyphIndex = static_cast<SdfText::Font::Glyph>( FT_Get_Char_Index( face.get(), static_cast<FT_ULong>( ch ) ) );
+
+				// Unique glyph
+				auto it = std::find_if( std::begin( glyphIndices ), std::end( glyphIndices ),
+					[glyphIndex]( const SdfText::Font::Glyph &elem ) -> bool {
+						return ( elem == glyphIndex );
+					}
+				);
+				if( std::end( glyphIndices ) == it ) {
+					glyphIndices.push_back( glyphIndex );
 				}
-			);
-			if( std::end( glyphIndices ) == it ) {
-				glyphIndices.push_back( glyphIndex );
-			}
 
-			// Character to glyph index and vice versa
-			mCharToGlyph[static_cast<SdfText::Font::Char>( ch )] = glyphIndex;
-			mGlyphToChar[glyphIndex] = static_cast<SdfText::Font::Char>( ch );
+				// Character to glyph index and vice versa
+				mapChar( static_cast<SdfText::Font::Char>( ch ), glyphIndex );
+			}
 		}
 
 		// Get texture atlas - will build if necessary
-		mTextureAtlases = SdfTextManager::instance()->getTextureAtlas( face, format, utf8Chars, glyphIndices );
+		mTextureAtlases = SdfTextManager::instance()->getTextureAtlas( font.mData->getFontFace(), format, utf8Chars, glyphIndices, bakeAsync );
 
 		// Build glyph metrics
 		{
-			FT_Face face = mFont.getFace();
+			GlyphOutlineCache& outlines = SdfTextManager::instance()->mGlyphOutlines;
 			for( const auto &glyphIndex : glyphIndices ) {
-				FT_Load_Glyph( face, glyphIndex, FT_LOAD_DEFAULT );
-				FT_GlyphSlot slot = face->glyph;
-				SdfText::Font::GlyphMetrics glyphMetrics;
-				glyphMetrics.advance = vec2( slot->linearHoriAdvance, slot->linearVertAdvance ) / 65536.0f;
-				glyphMetrics.minimum = vec2( slot->metrics.horiBearingX, slot->metrics.vertBearingY - slot->metrics.height ) / 64.0f;
-				glyphMetrics.maximum = vec2( slot->metrics.horiBearingX + slot->metrics.width, slot->metrics.vertBearingY ) / 64.0f;
-				mGlyphMetrics[glyphIndex] = glyphMetrics;
+				setGlyphMetrics( glyphIndex, outlines.getMetrics( *font.mData->getFontFace(), font.getSize(), glyphIndex ) );
 			}
 		}
+
+		// The atlas has laid out its glyphs, even if it's still baking them
+		placeGlyphRecords();
 	}
 }
 
@@ -1560,6 +3382,138 @@ SdfText::~SdfText()
 {
 }
 
+void SdfText::resolveChars( const std::string &utf8Chars ) const
+{
+	FT_Face face = mFont.getFace();
+	if( ( ! mFormat.getDynamic() ) || ( ! mTextureAtlases ) || ( nullptr == face ) ) {
+		return;
+	}
+
+	std::u32string utf32Chars = ci::toUtf32( utf8Chars );
+	// Control characters are never drawn
+	auto isNewChar = [this]( char32_t ch ) -> bool {
+		return ( ch >= 0x20 ) && ( 0x7F != ch ) && ( mCharToGlyph.end() == mCharToGlyph.find( static_cast<SdfText::Font::Char>( ch ) ) );
+	};
+	// Usually all of them have been seen before, then nothing is written and no face is leased
+	if( std::none_of( utf32Chars.begin(), utf32Chars.end(), isNewChar ) ) {
+		return;
+	}
+
+	const size_t firstNewGlyph = mPendingGlyphs.size();
+	{
+		FontFace::FaceLease face = mFont.mData->getFontFace()->acquire();
+		for( const auto &ch : utf32Chars ) {
+			if( ! isNewChar( ch ) ) {
+				continue;
+			}
+
+			SdfText::Font::Glyph glyphIndex = static_cast<SdfText::Font::Glyph>( FT_Get_Char_Index( face.get(), static_cast<FT_ULong>( ch ) ) );
+			mapChar( static_cast<SdfText::Font::Char>( ch ), glyphIndex );
+			if( ( mGlyphMetrics.end() == mGlyphMetrics.find( glyphIndex ) ) && ( mPendingGlyphs.end() == std::find( mPendingGlyphs.begin() + firstNewGlyph, mPendingGlyphs.end(), glyphIndex ) ) ) {
+				mPendingGlyphs.push_back( glyphIndex );
+			}
+		}
+	}
+
+	// Metrics lease a face of their own. The bounds come from the outline the bake uses later, so the glyphs measure 
+	// right before they're drawn.
+	GlyphOutlineCache& outlines = SdfTextManager::instance()->mGlyphOutlines;
+	for( size_t i = firstNewGlyph; i < mPendingGlyphs.size(); ++i ) {
+		setGlyphMetrics( mPendingGlyphs[i], outlines.getMetrics( *mFont.mData->getFontFace(), mFont.getSize(), mPendingGlyphs[i] ) );
+		GlyphRecord &glyphRecord = mGlyphRecords[addGlyphRecord( mPendingGlyphs[i] )];
+		glyphRecord.mPending = mTextureAtlases->measureGlyph( mPendingGlyphs[i], outlines, &glyphRecord.mPendingGlyphInfo );
+	}
+}
+
+void SdfText::bakePendingGlyphs()
+{
+	if( mPendingGlyphs.empty() ) {
+		return;
+	}
+
+	mTextureAtlases->addGlyphs( mPendingGlyphs, SdfTextManager::instance()->mGlyphOutlines );
+	mPendingGlyphs.clear();
+	placeGlyphRecords();
+
+	// The atlas may have grown past the budget
+	SdfTextManager::instance()->trimTextureAtlases();
+}
+
+uint32_t SdfText::addGlyphRecord( SdfText::Font::Glyph glyph ) const
+{
+	if( glyph >= mGlyphIds.size() ) {
+		mGlyphIds.resize( static_cast<size_t>( glyph ) + 1, INVALID_GLYPH_ID );
+	}
+
+	uint32_t &glyphId = mGlyphIds[glyph];
+	if( INVALID_GLYPH_ID == glyphId ) {
+		glyphId = static_cast<uint32_t>( mGlyphRecords.size() );
+		GlyphRecord record;
+		record.mGlyph = glyph;
+		mGlyphRecords.push_back( record );
+	}
+	return glyphId;
+}
+
+void SdfText::mapChar( SdfText::Font::Char ch, SdfText::Font::Glyph glyph ) const
+{
+	const uint32_t glyphId = addGlyphRecord( glyph );
+	mGlyphRecords[glyphId].mChar = ch;
+	mCharToGlyph[ch] = glyph;
+	if( ch < mLatinGlyphIds.size() ) {
+		mLatinGlyphIds[ch] = glyphId;
+	}
+}
+
+void SdfText::setGlyphMetrics( SdfText::Font::Glyph glyph, const SdfText::Font::GlyphMetrics &metrics ) const
+{
+	mGlyphRecords[addGlyphRecord( glyph )].mMetrics = metrics;
+	mGlyphMetrics[glyph] = metrics;
+}
+
+void SdfText::placeGlyphRecords() const
+{
+	// The atlas never drops glyphs and its map doesn't move them, so the placements can be pointed at
+	const SdfText::Font::GlyphInfoMap &glyphInfo = mTextureAtlases->mGlyphInfo;
+	for( size_t i = mNumPlacedGlyphRecords; i < mGlyphRecords.size(); ++i ) {
+		auto it = glyphInfo.find( mGlyphRecords[i].mGlyph );
+		mGlyphRecords[i].mGlyphInfo = ( glyphInfo.end() != it ) ? &it->second : nullptr;
+	}
+	mNumPlacedGlyphRecords = mGlyphRecords.size();
+}
+
+uint32_t SdfText::findGlyphId( SdfText::Font::Char ch ) const
+{
+	if( ch < mLatinGlyphIds.size() ) {
+		return mLatinGlyphIds[ch];
+	}
+
+	auto it = mCharToGlyph.find( ch );
+	return ( mCharToGlyph.end() != it ) ? mGlyphIds[it->second] : INVALID_GLYPH_ID;
+}
+
+const SdfText::Font::GlyphInfo* SdfText::findGlyphInfo( SdfText::Font::Glyph glyph ) const
+{
+	if( glyph < mGlyphIds.size() ) {
+		const uint32_t glyphId = mGlyphIds[glyph];
+		if( glyphId < mNumPlacedGlyphRecords ) {
+			return mGlyphRecords[glyphId].mGlyphInfo;
+		}
+	}
+
+	// Glyphs this SdfText hasn't placed, another one sharing the atlas may have
+	auto it = mTextureAtlases->mGlyphInfo.find( glyph );
+	if( mTextureAtlases->mGlyphInfo.end() != it ) {
+		return &it->second;
+	}
+
+	// Otherwise they may still be waiting for the bake
+	if( ( glyph < mGlyphIds.size() ) && ( INVALID_GLYPH_ID != mGlyphIds[glyph] ) && mGlyphRecords[mGlyphIds[glyph]].mPending ) {
+		return &mGlyphRecords[mGlyphIds[glyph]].mPendingGlyphInfo;
+	}
+	return nullptr;
+}
+
 SdfTextRef SdfText::create( const SdfText::Font &font, const Format &format, const std::string &supportedChars )
 {
 	SdfTextRef result = SdfTextRef( new SdfText( font, format, supportedChars ) );
@@ -1584,9 +3538,63 @@ cinder::gl::SdfTextRef SdfText::create( const fs::path& filePath, const SdfText:
 	return result;
 }
 
+SdfText::FutureRef SdfText::createAsync( const SdfText::Font &font, const Format &format, const std::string &utf8Chars, const std::function<void( const SdfTextRef& )> &readyFn )
+{
+	SdfTextRef sdfText = SdfTextRef( new SdfText( font, format, utf8Chars, true, true ) );
+	FutureRef result = FutureRef( new Future( sdfText, readyFn ) );
+	// Kept until it's ready, so the callback fires even if the caller drops the future
+	SdfTextManager *fontManager = SdfTextManager::instance();
+	std::lock_guard<std::recursive_mutex> lock( fontManager->mMutex );
+	fontManager->mPendingFutures.push_back( result );
+	return result;
+}
+
+void SdfText::updateAsync()
+{
+	SdfTextManager *fontManager = SdfTextManager::instance();
+	// The callbacks may create more futures, and other threads may too while these are polled
+	std::vector<FutureRef> futures;
+	{
+		std::lock_guard<std::recursive_mutex> lock( fontManager->mMutex );
+		futures.swap( fontManager->mPendingFutures );
+	}
+
+	std::vector<FutureRef> stillPending;
+	for( const auto &future : futures ) {
+		if( ! future->isReady() ) {
+			stillPending.push_back( future );
+		}
+	}
+
+	std::lock_guard<std::recursive_mutex> lock( fontManager->mMutex );
+	auto &pendingFutures = fontManager->mPendingFutures;
+	pendingFutures.insert( pendingFutures.end(), stillPending.begin(), stillPending.end() );
+}
+
+bool SdfText::Future::finish( bool wait )
+{
+	if( mReady ) {
+		return true;
+	}
+
+	if( ! mSdfText->mTextureAtlases->finishBake( wait ) ) {
+		return false;
+	}
+
+	// Uploading may have pushed the cache past the budget
+	SdfTextManager::instance()->trimTextureAtlases();
+
+	mReady = true;
+	if( mReadyFn ) {
+		mReadyFn( mSdfText );
+	}
+	return true;
+}
+
 void SdfText::save(const ci::DataTargetRef& target, const SdfTextRef& sdfText)
 {
-	const uint32_t kCurrentVersion = 0x00000001;
+	// Version 2 adds the channel count of the textures
+	const uint32_t kCurrentVersion = 0x00000002;
 
 	if( ! target ) {
 		throw ci::Exception( "Invalid data target" );
@@ -1682,6 +3690,8 @@ void SdfText::save(const ci::DataTargetRef& target, const SdfTextRef& sdfText)
 		os->write( static_cast<uint8_t>( 'A' ) );
 		os->write( static_cast<uint8_t>( 'T' ) );
 
+		// Number of channels
+		os->writeLittle( sdfText->mTextureAtlases->mNumChannels );
 		// SDF scale
 		os->writeLittle( sdfText->mTextureAtlases->mSdfScale.x );
 		os->writeLittle( sdfText->mTextureAtlases->mSdfScale.y );
@@ -1719,10 +3729,10 @@ void SdfText::save(const ci::DataTargetRef& target, const SdfTextRef& sdfText)
 		}
 
 		// Number of textures
-		const uint32_t numTextures = static_cast<uint32_t>( sdfText->mTextureAtlases->mTextures.size() );
+		const uint32_t numTextures = static_cast<uint32_t>( sdfText->mTextureAtlases->mPages->mTextures.size() );
 		os->writeLittle( numTextures );
 		// Textures
-		for( const auto& tex : sdfText->mTextureAtlases->mTextures ) {
+		for( const auto& tex : sdfText->mTextureAtlases->mPages->mTextures ) {
 			// Write texture to PNG using memory buffer
 			ImageSourceRef pngSource = tex->createSource();
 			OStreamMemRef pngStream = OStreamMem::create();
@@ -1821,8 +3831,7 @@ SdfTextRef SdfText::load( const ci::DataSourceRef& source, float size )
 			is->readLittle( &ch );
 			is->readLittle( &glyph );
 			SdfText::Font::Char sdftCh = static_cast<SdfText::Font::Char>( ch );
-			sdfText->mCharToGlyph[sdftCh] = glyph;
-			sdfText->mGlyphToChar[glyph] = sdftCh;
+			sdfText->mapChar( sdftCh, glyph );
 		}		
 	}
 
@@ -1852,7 +3861,7 @@ SdfTextRef SdfText::load( const ci::DataSourceRef& source, float size )
 			metrics.advance *= font.mFontScale;
 			metrics.minimum *= font.mFontScale;
 			metrics.maximum *= font.mFontScale;
-			sdfText->mGlyphMetrics[glyph] = metrics;
+			sdfText->setGlyphMetrics( glyph, metrics );
 		}
 	}
 
@@ -1868,6 +3877,11 @@ SdfTextRef SdfText::load( const ci::DataSourceRef& source, float size )
 		// Create TextureAtlas
 		TextureAtlasRef textureAtlases = TextureAtlasRef( new TextureAtlas() );
 
+		// Number of channels, version 1 files are always MSDF
+		if( version >= 2 ) {
+			is->readLittle( &(textureAtlases->mNumChannels) );
+		}
+
 		// SDF scale
 		is->readLittle( &(textureAtlases->mSdfScale.x) );
 		is->readLittle( &(textureAtlases->mSdfScale.y) );
@@ -1903,6 +3917,7 @@ SdfTextRef SdfText::load( const ci::DataSourceRef& source, float size )
 			is->readLittle( &(glyphInfo.mSize.x) );
 			is->readLittle( &(glyphInfo.mSize.y) );
 			textureAtlases->mGlyphInfo[glyph] = glyphInfo;
+			textureAtlases->mPages->mTileArea += static_cast<double>( glyphInfo.mTexCoords.getWidth() ) * static_cast<double>( glyphInfo.mTexCoords.getHeight() );
 		}
 
 		// Number of textures
@@ -1923,12 +3938,13 @@ SdfTextRef SdfText::load( const ci::DataSourceRef& source, float size )
 			is->readData( buffer->getData(), buffer->getSize() );
 			// Create surface
 			ImageSourceRef pngSource = loadImage( DataSourceBuffer::create( buffer ) );
-			gl::TextureRef tex = gl::Texture2d::create( pngSource );
+			gl::TextureRef tex = ( 1 == textureAtlases->mNumChannels ) ? gl::Texture2d::create( Channel8u( pngSource ) ) : gl::Texture2d::create( pngSource );
 			// Add texture
-			textureAtlases->mTextures.push_back( tex );
+			textureAtlases->mPages->mTextures.push_back( tex );
 		}
 
 		sdfText->mTextureAtlases = textureAtlases;
+		sdfText->placeGlyphRecords();
 	}
 
 	return sdfText;
@@ -1939,173 +3955,121 @@ SdfTextRef SdfText::load( const ci::fs::path& filePath, float size )
 	return SdfText::load( ci::DataSourcePath::create( filePath ), size );
 }
 
-void SdfText::drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const vec2 &baselineIn, const DrawOptions &options, const std::vector<ColorA8u> &colors )
+void SdfText::placeGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const DrawOptions &options, PlacedGlyphs *result, bool boundsOnly ) const
 {
-	const auto& textures = mTextureAtlases->mTextures;
-	const auto& glyphMap = mTextureAtlases->mGlyphInfo;
+	// Measuring leaves the textures alone, other threads may be adding to shared pages
+	const auto& textures = mTextureAtlases->mPages->mTextures;
 	const auto& sdfScale = mTextureAtlases->mSdfScale;
-	const auto& sdfPadding = mTextureAtlases->mSdfPadding;
-	const auto& sdfBitmapSize = mTextureAtlases->mSdfBitmapSize;
-
-	if( textures.empty() ) {
-		return;
-	}
-
-	if( ! colors.empty() ) {
-		assert( glyphMeasures.size() == colors.size() );
-	}
-
-	auto shader = options.getGlslProg();
-	if( ! shader ) {
-		shader = SdfText::defaultShader();
-	}
-	ScopedTextureBind texBindScp( textures[0] );
-	ScopedGlslProg glslScp( shader );
-
-	vec2 baseline = baselineIn;
-
-	if( ! options.getGlslProg() ) {
-		shader->uniform( "uFgColor", gl::context()->getCurrentColor() );
-		shader->uniform( "uPremultiply", options.getPremultiply() ? 1.0f : 0.0f );
-		shader->uniform( "uGamma", options.getGamma() );
-#if defined(CINDER_GL_ES)
-		shader->uniform( "uTexSize", vec2( textures[0]->getSize() ) );
-#endif
-	}
-
-	const vec2 fontRenderScale = vec2( mFont.getSize() ) / ( 32.0f * mTextureAtlases->mSdfScale );
-	const vec2 fontOriginScale = vec2( mFont.getSize() ) / 32.0f;
-
-	const float scale = options.getScale();
-	for( size_t texIdx = 0; texIdx < textures.size(); ++texIdx ) {
-		std::vector<float> verts, texCoords;
-		std::vector<ColorA8u> vertColors;
-		const gl::TextureRef &curTex = textures[texIdx];
-
-		std::vector<uint32_t> indices;
-		uint32_t curIdx = 0;
-		GLenum indexType = GL_UNSIGNED_INT;
-
-		if( options.getPixelSnap() ) {
-			baseline = vec2( floor( baseline.x ), floor( baseline.y ) );
-		}
-			
-		for( std::vector<std::pair<SdfText::Font::Glyph,vec2> >::const_iterator glyphIt = glyphMeasures.begin(); glyphIt != glyphMeasures.end(); ++glyphIt ) {
-			SdfText::Font::GlyphInfoMap::const_iterator glyphInfoIt = glyphMap.find( glyphIt->first );
-			if(  glyphInfoIt == glyphMap.end() ) {
-				continue;
-			}
-				
-			const auto &glyphInfo = glyphInfoIt->second;
-			if( glyphInfo.mTextureIndex != texIdx ) {
-				continue;
-			}
-
-			const auto &originOffset = glyphInfo.mOriginOffset;
-
-			Rectf srcTexCoords = curTex->getAreaTexCoords( glyphInfo.mTexCoords );
-			Rectf destRect = Rectf( glyphInfo.mTexCoords );
-			destRect.scale( scale );
-			destRect -= destRect.getUpperLeft();
-			vec2 offset = vec2( 0, -( destRect.getHeight() ) );
-			// Reverse the transformation applied during SDF generation
-			float tx = sdfPadding.x;
-			float ty = std::fabs( originOffset.y ) + sdfPadding.y;
-			offset += scale * sdfScale * vec2( -tx, ty );
-			// Use origin scale for horizontal offset
-			offset += scale * fontOriginScale * vec2( glm::max( originOffset.x, 0.0f ), 0.0f );
-			destRect += offset;
-			destRect.scale( fontRenderScale );
-
-			destRect += glyphIt->second * scale;
-			destRect += baseline;
-			
-			verts.push_back( destRect.getX2() ); verts.push_back( destRect.getY1() );
-			verts.push_back( destRect.getX1() ); verts.push_back( destRect.getY1() );
-			verts.push_back( destRect.getX2() ); verts.push_back( destRect.getY2() );
-			verts.push_back( destRect.getX1() ); verts.push_back( destRect.getY2() );
+	const auto& sdfPadding = mTextureAtlases->mSdfPadding;
+	const uint32_t numTextures = boundsOnly ? 0 : static_cast<uint32_t>( textures.size() );
 
-			texCoords.push_back( srcTexCoords.getX2() ); texCoords.push_back( srcTexCoords.getY1() );
-			texCoords.push_back( srcTexCoords.getX1() ); texCoords.push_back( srcTexCoords.getY1() );
-			texCoords.push_back( srcTexCoords.getX2() ); texCoords.push_back( srcTexCoords.getY2() );
-			texCoords.push_back( srcTexCoords.getX1() ); texCoords.push_back( srcTexCoords.getY2() );
-			
-			if( ! colors.empty() ) {
-				for( int i = 0; i < 4; ++i ) {
-					vertColors.push_back( colors[glyphIt-glyphMeasures.begin()] );
-				}
-			}
+	const vec2 fontRenderScale = vec2( mFont.getSize() ) / ( 32.0f * mTextureAtlases->mSdfScale );
+	const vec2 fontOriginScale = vec2( mFont.getSize() ) / 32.0f;
+	const float scale = options.getScale();
 
-			indices.push_back( curIdx + 0 ); indices.push_back( curIdx + 1 ); indices.push_back( curIdx + 2 );
-			indices.push_back( curIdx + 2 ); indices.push_back( curIdx + 1 ); indices.push_back( curIdx + 3 );
-			curIdx += 4;
-		}
-		
-		if( curIdx == 0 ) {
+	auto &placements = result->mPlacements;
+	auto &measureIndices = result->mMeasureIndices;
+	auto &textureStarts = result->mTextureStarts;
+	placements.clear();
+	measureIndices.clear();
+	textureStarts.assign( numTextures + 1, 0 );
+	result->mBounds = Rectf( 0, 0, 0, 0 );
+
+	// Placements come out in layout order first, textureStarts counts them per texture
+	std::vector<uint32_t> placementTextures;
+	if( ! boundsOnly ) {
+		placements.reserve( glyphMeasures.size() );
+		measureIndices.reserve( glyphMeasures.size() );
+	}
+	for( size_t i = 0; i < glyphMeasures.size(); ++i ) {
+		const auto &glyphMeasure = glyphMeasures[i];
+		const SdfText::Font::GlyphInfo *glyphInfoPtr = findGlyphInfo( glyphMeasure.first );
+		if( nullptr == glyphInfoPtr ) {
 			continue;
 		}
-		
-		curTex->bind();
-		auto ctx = gl::context();
-		size_t dataSize = (verts.size() + texCoords.size()) * sizeof(float) + vertColors.size() * sizeof(ColorA8u);
-		gl::ScopedVao vaoScp( ctx->getDefaultVao() );
-		ctx->getDefaultVao()->replacementBindBegin();
-		VboRef defaultElementVbo = ctx->getDefaultElementVbo( indices.size() * sizeof(curIdx) );
-		VboRef defaultArrayVbo = ctx->getDefaultArrayVbo( dataSize );
 
-		ScopedBuffer vboArrayScp( defaultArrayVbo );
-		ScopedBuffer vboElScp( defaultElementVbo );
+		const auto &glyphInfo = *glyphInfoPtr;
+		const auto &originOffset = glyphInfo.mOriginOffset;
+		const auto &size = glyphInfo.mSize;
 
-		size_t dataOffset = 0;
-		int posLoc = shader->getAttribSemanticLocation( geom::Attrib::POSITION );
-		if( posLoc >= 0 ) {
-			enableVertexAttribArray( posLoc );
-			vertexAttribPointer( posLoc, 2, GL_FLOAT, GL_FALSE, 0, (void*)0 );
-			defaultArrayVbo->bufferSubData( dataOffset, verts.size() * sizeof(float), verts.data() );
-			dataOffset += verts.size() * sizeof(float);
+		Rectf destRect = Rectf( glyphInfo.mTexCoords );
+		destRect.scale( scale );
+		destRect -= destRect.getUpperLeft();
+		vec2 offset = vec2( 0, -( destRect.getHeight() ) );
+		// Reverse the transformation applied during SDF generation
+		float tx = sdfPadding.x;
+		float ty = std::fabs( originOffset.y ) + sdfPadding.y;
+		offset += scale * sdfScale * vec2( -tx, ty );
+		// Use origin scale for horizontal offset
+		offset += scale * fontOriginScale * vec2( glm::max( originOffset.x, 0.0f ), 0.0f );
+		destRect += offset;
+		destRect.scale( fontRenderScale );
+
+		destRect += glyphMeasure.second * scale;
+
+		// Tight bounds of the outline, without the SDF padding
+		Rectf bounds;
+		bounds.x1 = destRect.x1 + ( ( sdfPadding.x + originOffset.x ) * fontOriginScale.x );
+		bounds.y2 = destRect.y2 - ( sdfPadding.y * fontOriginScale.y );
+		bounds.x2 = bounds.x1 + ( ( size.x + 1.0f ) * fontOriginScale.x );
+		bounds.y1 = bounds.y2 - ( ( size.y + 1.0f ) * fontOriginScale.y );
+		bounds.x1 -= ( 0.5f * fontOriginScale.x );
+		bounds.y1 -= ( 0.5f * fontOriginScale.y );
+		bounds.x2 += ( 0.5f * fontOriginScale.x );
+		bounds.y2 += ( 0.5f * fontOriginScale.y );
+
+		Rectf &resultBounds = result->mBounds;
+		if( ( resultBounds.getWidth() > 0 ) || ( resultBounds.getHeight() > 0 ) ) {
+			resultBounds.x1 = std::min( resultBounds.x1, bounds.x1 );
+			resultBounds.y1 = std::min( resultBounds.y1, bounds.y1 );
+			resultBounds.x2 = std::max( resultBounds.x2, bounds.x2 );
+			resultBounds.y2 = std::max( resultBounds.y2, bounds.y2 );
 		}
-		int texLoc = shader->getAttribSemanticLocation( geom::Attrib::TEX_COORD_0 );
-		if( texLoc >= 0 ) {
-			enableVertexAttribArray( texLoc );
-			vertexAttribPointer( texLoc, 2, GL_FLOAT, GL_FALSE, 0, (void*)dataOffset );
-			defaultArrayVbo->bufferSubData( dataOffset, texCoords.size() * sizeof(float), texCoords.data() );
-			dataOffset += texCoords.size() * sizeof(float);
+		else {
+			resultBounds = bounds;
 		}
-		if( ! vertColors.empty() ) {
-			int colorLoc = shader->getAttribSemanticLocation( geom::Attrib::COLOR );
-			if( colorLoc >= 0 ) {
-				enableVertexAttribArray( colorLoc );
-				vertexAttribPointer( colorLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (void*)dataOffset );
-				defaultArrayVbo->bufferSubData( dataOffset, vertColors.size() * sizeof(ColorA8u), vertColors.data() );
-				dataOffset += vertColors.size() * sizeof(ColorA8u);				
-			}
+
+		// Glyphs baked since the textures were last uploaded can't be drawn yet
+		if( boundsOnly || ( glyphInfo.mTextureIndex >= numTextures ) ) {
+			continue;
 		}
 
-		defaultElementVbo->bufferSubData( 0, indices.size() * sizeof(curIdx), indices.data() );
-		ctx->getDefaultVao()->replacementBindEnd();
-		gl::setDefaultShaderVars();
-		ctx->drawElements( GL_TRIANGLES, (GLsizei)indices.size(), indexType, 0 );
+		SdfText::CharPlacement place = {};
+		place.mGlyph = glyphMeasure.first;
+		place.mSrcTexCoords = textures[glyphInfo.mTextureIndex]->getAreaTexCoords( glyphInfo.mTexCoords );
+		place.mDstRect = destRect;
+		placements.push_back( place );
+		measureIndices.push_back( static_cast<uint32_t>( i ) );
+		placementTextures.push_back( glyphInfo.mTextureIndex );
+		++textureStarts[glyphInfo.mTextureIndex + 1];
 	}
-}
-
-void SdfText::drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const Rectf &clip, vec2 offset, const DrawOptions &options, const std::vector<ColorA8u> &colors )
-{
-	const auto& textures = mTextureAtlases->mTextures;
-	const auto& glyphMap = mTextureAtlases->mGlyphInfo;
-	const auto& sdfPadding = mTextureAtlases->mSdfPadding;
-	const auto& sdfBitmapSize = mTextureAtlases->mSdfBitmapSize;
 
-	if( textures.empty() ) {
-		return;
+	for( uint32_t texIdx = 0; texIdx < numTextures; ++texIdx ) {
+		textureStarts[texIdx + 1] += textureStarts[texIdx];
 	}
 
-	if( ! colors.empty() ) {
-		assert( glyphMeasures.size() == colors.size() );
+	// Group by texture, unless they're all on one already
+	if( ( ! placements.empty() ) && ( textureStarts[placementTextures[0] + 1] - textureStarts[placementTextures[0]] != placements.size() ) ) {
+		std::vector<SdfText::CharPlacement> grouped( placements.size() );
+		std::vector<uint32_t> groupedIndices( placements.size() );
+		std::vector<uint32_t> fill( textureStarts.begin(), textureStarts.end() - 1 );
+		for( size_t i = 0; i < placements.size(); ++i ) {
+			uint32_t dst = fill[placementTextures[i]]++;
+			grouped[dst] = placements[i];
+			groupedIndices[dst] = measureIndices[i];
+		}
+		placements.swap( grouped );
+		measureIndices.swap( groupedIndices );
 	}
+}
+
+void SdfText::drawPlacedGlyphs( const PlacedGlyphs &placedGlyphs, const vec2 &offset, const Rectf *clip, const DrawOptions &options, const std::vector<ColorA8u> &colors )
+{
+	const auto& textures = mTextureAtlases->mPages->mTextures;
 
 	auto shader = options.getGlslProg();
 	if( ! shader ) {
-		shader = SdfText::defaultShader();
+		shader = SdfText::defaultShader( 1 == mTextureAtlases->mNumChannels );
 	}
 	ScopedTextureBind texBindScp( textures[0] );
 	ScopedGlslProg glslScp( shader );
@@ -2119,85 +4083,62 @@ void SdfText::drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures,
 #endif
 	}
 
-	const vec2 fontRenderScale = vec2( mFont.getSize() ) / ( 32.0f * mTextureAtlases->mSdfScale );
-	const vec2 fontOriginScale = vec2( mFont.getSize() ) / 32.0f;
-
-	const float scale = options.getScale();
+	std::vector<float> verts, texCoords;
+	std::vector<ColorA8u> vertColors;
+	std::vector<uint32_t> indices;
 	for( size_t texIdx = 0; texIdx < textures.size(); ++texIdx ) {
-		std::vector<float> verts, texCoords;
-		std::vector<ColorA8u> vertColors;
 		const gl::TextureRef &curTex = textures[texIdx];
 
-		std::vector<uint32_t> indices;
+		verts.clear();
+		texCoords.clear();
+		vertColors.clear();
+		indices.clear();
 		uint32_t curIdx = 0;
 		GLenum indexType = GL_UNSIGNED_INT;
 
-		if( options.getPixelSnap() ) {
-			offset = vec2( floor( offset.x ), floor( offset.y ) );
-		}
+		for( uint32_t placeIdx = placedGlyphs.mTextureStarts[texIdx]; placeIdx < placedGlyphs.mTextureStarts[texIdx + 1]; ++placeIdx ) {
+			Rectf srcTexCoords = placedGlyphs.mPlacements[placeIdx].mSrcTexCoords;
+			Rectf destRect = placedGlyphs.mPlacements[placeIdx].mDstRect + offset;
 
-		for( std::vector<std::pair<Font::Glyph,vec2> >::const_iterator glyphIt = glyphMeasures.begin(); glyphIt != glyphMeasures.end(); ++glyphIt ) {
-			SdfText::Font::GlyphInfoMap::const_iterator glyphInfoIt = glyphMap.find( glyphIt->first );
-			if( glyphInfoIt == glyphMap.end() ) {
-				continue;
-			}
-				
-			const auto &glyphInfo = glyphInfoIt->second;
-			if( glyphInfo.mTextureIndex != texIdx ) {
-				continue;
-			}
+			if( nullptr != clip ) {
+				Rectf clipped( destRect );
+				if( options.getClipHorizontal() ) {
+					clipped.x1 = std::max( destRect.x1, clip->x1 );
+					clipped.x2 = std::min( destRect.x2, clip->x2 );
+				}
+				if( options.getClipVertical() ) {
+					clipped.y1 = std::max( destRect.y1, clip->y1 );
+					clipped.y2 = std::min( destRect.y2, clip->y2 );
+				}
 
-			Rectf srcTexCoords = curTex->getAreaTexCoords( glyphInfo.mTexCoords );
-			Rectf destRect( glyphInfo.mTexCoords );
-			destRect.scale( fontRenderScale );
-			destRect -= destRect.getUpperLeft();
-			destRect.scale( scale );
-			destRect += glyphIt->second * scale;
-			destRect += vec2( offset.x, offset.y );
-			vec2 originOffset = fontOriginScale * glyphInfo.mOriginOffset;
-			destRect += vec2( floor( originOffset.x + 0.5f ), floor( -originOffset.y ) ) * scale;
-            destRect += fontRenderScale * vec2( -sdfPadding.x, -sdfPadding.y );
-			if( options.getPixelSnap() ) {
-				destRect -= vec2( destRect.x1 - floor( destRect.x1 ), destRect.y1 - floor( destRect.y1 ) );	
-			}
+				if( clipped.x1 >= clipped.x2 || clipped.y1 >= clipped.y2 ) {
+					continue;
+				}
 
-			// clip
-			Rectf clipped( destRect );
-			if( options.getClipHorizontal() ) {
-				clipped.x1 = std::max( destRect.x1, clip.x1 );
-				clipped.x2 = std::min( destRect.x2, clip.x2 );
-			}
-			if( options.getClipVertical() ) {
-				clipped.y1 = std::max( destRect.y1, clip.y1 );
-				clipped.y2 = std::min( destRect.y2, clip.y2 );
-			}
-			
-			if( clipped.x1 >= clipped.x2 || clipped.y1 >= clipped.y2 ) {
-				continue;
+				vec2 coordScale = vec2( srcTexCoords.getWidth() / destRect.getWidth(), srcTexCoords.getHeight() / destRect.getHeight() );
+				srcTexCoords.x1 = srcTexCoords.x1 + ( clipped.x1 - destRect.x1 ) * coordScale.x;
+				srcTexCoords.x2 = srcTexCoords.x1 + ( clipped.x2 - clipped.x1  ) * coordScale.x;
+				srcTexCoords.y1 = srcTexCoords.y1 + ( clipped.y1 - destRect.y1 ) * coordScale.y;
+				srcTexCoords.y2 = srcTexCoords.y1 + ( clipped.y2 - clipped.y1  ) * coordScale.y;
+				destRect = clipped;
 			}
 
-			verts.push_back( clipped.getX2() ); verts.push_back( clipped.getY1() );
-			verts.push_back( clipped.getX1() ); verts.push_back( clipped.getY1() );
-			verts.push_back( clipped.getX2() ); verts.push_back( clipped.getY2() );
-			verts.push_back( clipped.getX1() ); verts.push_back( clipped.getY2() );
-
-			vec2 coordScale = vec2( srcTexCoords.getWidth() / destRect.getWidth(), srcTexCoords.getHeight() / destRect.getHeight() );
-			srcTexCoords.x1 = srcTexCoords.x1 + ( clipped.x1 - destRect.x1 ) * coordScale.x;
-			srcTexCoords.x2 = srcTexCoords.x1 + ( clipped.x2 - clipped.x1  ) * coordScale.x;
-			srcTexCoords.y1 = srcTexCoords.y1 + ( clipped.y1 - destRect.y1 ) * coordScale.y;
-			srcTexCoords.y2 = srcTexCoords.y1 + ( clipped.y2 - clipped.y1  ) * coordScale.y;
+			verts.push_back( destRect.getX2() ); verts.push_back( destRect.getY1() );
+			verts.push_back( destRect.getX1() ); verts.push_back( destRect.getY1() );
+			verts.push_back( destRect.getX2() ); verts.push_back( destRect.getY2() );
+			verts.push_back( destRect.getX1() ); verts.push_back( destRect.getY2() );
 
 			texCoords.push_back( srcTexCoords.getX2() ); texCoords.push_back( srcTexCoords.getY1() );
 			texCoords.push_back( srcTexCoords.getX1() ); texCoords.push_back( srcTexCoords.getY1() );
 			texCoords.push_back( srcTexCoords.getX2() ); texCoords.push_back( srcTexCoords.getY2() );
 			texCoords.push_back( srcTexCoords.getX1() ); texCoords.push_back( srcTexCoords.getY2() );
-
+			
 			if( ! colors.empty() ) {
 				for( int i = 0; i < 4; ++i ) {
-					vertColors.push_back( colors[glyphIt-glyphMeasures.begin()] );
+					vertColors.push_back( colors[placedGlyphs.mMeasureIndices[placeIdx]] );
 				}
 			}
-			
+
 			indices.push_back( curIdx + 0 ); indices.push_back( curIdx + 1 ); indices.push_back( curIdx + 2 );
 			indices.push_back( curIdx + 2 ); indices.push_back( curIdx + 1 ); indices.push_back( curIdx + 3 );
 			curIdx += 4;
@@ -2250,172 +4191,233 @@ void SdfText::drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures,
 	}
 }
 
+void SdfText::drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const vec2 &baselineIn, const DrawOptions &options, const std::vector<ColorA8u> &colors )
+{
+	bakePendingGlyphs();
+
+	if( mTextureAtlases->mPages->mTextures.empty() ) {
+		return;
+	}
+
+	if( ! colors.empty() ) {
+		assert( glyphMeasures.size() == colors.size() );
+	}
+
+	vec2 baseline = baselineIn;
+	if( options.getPixelSnap() ) {
+		baseline = vec2( floor( baseline.x ), floor( baseline.y ) );
+	}
+
+	PlacedGlyphs placedGlyphs;
+	placeGlyphs( glyphMeasures, options, &placedGlyphs );
+	drawPlacedGlyphs( placedGlyphs, baseline, nullptr, options, colors );
+}
+
+void SdfText::drawGlyphs( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const Rectf &clip, vec2 offset, const DrawOptions &options, const std::vector<ColorA8u> &colors )
+{
+	bakePendingGlyphs();
+
+	if( mTextureAtlases->mPages->mTextures.empty() ) {
+		return;
+	}
+
+	if( ! colors.empty() ) {
+		assert( glyphMeasures.size() == colors.size() );
+	}
+
+	if( options.getPixelSnap() ) {
+		offset = vec2( floor( offset.x ), floor( offset.y ) );
+	}
+
+	PlacedGlyphs placedGlyphs;
+	placeGlyphs( glyphMeasures, options, &placedGlyphs );
+	drawPlacedGlyphs( placedGlyphs, offset, &clip, options, colors );
+}
+
 void SdfText::drawString( const std::string &str, const vec2 &baseline, const DrawOptions &options )
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( SdfTextBox::GROW, SdfTextBox::GROW ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	SdfText::Font::GlyphMeasuresList glyphMeasures = tbox.measureGlyphs( options );
+	SdfText::Font::GlyphMeasuresList glyphMeasures = layoutString( str, ivec2( SdfTextBox::GROW, SdfTextBox::GROW ), options );
 	drawGlyphs( glyphMeasures, baseline, options );
 }
 
 void SdfText::drawString( const std::string &str, const Rectf &fitRect, const vec2 &offset, const DrawOptions &options )
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( SdfTextBox::GROW, (int)fitRect.getHeight() ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	SdfText::Font::GlyphMeasuresList glyphMeasures = tbox.measureGlyphs( options );
+	SdfText::Font::GlyphMeasuresList glyphMeasures = layoutString( str, ivec2( SdfTextBox::GROW, (int)fitRect.getHeight() ), options );
 	drawGlyphs( glyphMeasures, fitRect, fitRect.getUpperLeft() + offset, options );	
 }
 
 void SdfText::drawStringWrapped( const std::string &str, const Rectf &fitRect, const vec2 &offset, const DrawOptions &options )
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( (int)fitRect.getWidth(), (int)fitRect.getHeight() ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	SdfText::Font::GlyphMeasuresList glyphMeasures = tbox.measureGlyphs( options );
+	SdfText::Font::GlyphMeasuresList glyphMeasures = layoutString( str, ivec2( (int)fitRect.getWidth(), (int)fitRect.getHeight() ), options );
 	drawGlyphs( glyphMeasures, fitRect.getUpperLeft() + offset, options );
 }
 
-std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> SdfText::placeChars( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const vec2 &baselineIn, const DrawOptions &options )
+std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> SdfText::placeChars( const SdfText::Font::GlyphMeasuresList &glyphMeasures, const vec2 &baselineIn, const DrawOptions &options, Rectf *bounds )
 {
-	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> result;
+	bakePendingGlyphs();
 
-	const auto& textures = mTextureAtlases->mTextures;
-	const auto& glyphMap = mTextureAtlases->mGlyphInfo;
-	const auto& sdfScale = mTextureAtlases->mSdfScale;
-	const auto& sdfPadding = mTextureAtlases->mSdfPadding;
-	const auto& sdfBitmapSize = mTextureAtlases->mSdfBitmapSize;
+	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> result;
 
 	vec2 baseline = baselineIn;
+	if( options.getPixelSnap() ) {
+		baseline = vec2( floor( baseline.x ), floor( baseline.y ) );
+	}
 
-	const vec2 fontRenderScale = vec2( mFont.getSize() ) / ( 32.0f * mTextureAtlases->mSdfScale );
-	const vec2 fontOriginScale = vec2( mFont.getSize() ) / 32.0f;
+	PlacedGlyphs placedGlyphs;
+	placeGlyphs( glyphMeasures, options, &placedGlyphs );
 
-	const float scale = options.getScale();
-	for( size_t texIdx = 0; texIdx < textures.size(); ++texIdx ) {
-		std::vector<float> verts, texCoords;
-		std::vector<ColorA8u> vertColors;
-		const gl::TextureRef &curTex = textures[texIdx];
+	const auto &textureStarts = placedGlyphs.mTextureStarts;
+	for( size_t texIdx = 0; texIdx + 1 < textureStarts.size(); ++texIdx ) {
+		if( textureStarts[texIdx] == textureStarts[texIdx + 1] ) {
+			continue;
+		}
 
-		if( options.getPixelSnap() ) {
-			baseline = vec2( floor( baseline.x ), floor( baseline.y ) );
+		std::vector<SdfText::CharPlacement> charPlacements( placedGlyphs.mPlacements.begin() + textureStarts[texIdx], placedGlyphs.mPlacements.begin() + textureStarts[texIdx + 1] );
+		for( auto &place : charPlacements ) {
+			place.mDstRect += baseline;
 		}
+		result.push_back( std::make_pair( static_cast<uint8_t>( texIdx ), std::move( charPlacements ) ) );
+	}
 
-		std::vector<SdfText::CharPlacement> charPlacements;	
-		for( std::vector<std::pair<SdfText::Font::Glyph,vec2> >::const_iterator glyphIt = glyphMeasures.begin(); glyphIt != glyphMeasures.end(); ++glyphIt ) {
-			SdfText::Font::GlyphInfoMap::const_iterator glyphInfoIt = glyphMap.find( glyphIt->first );
-			if(  glyphInfoIt == glyphMap.end() ) {
-				continue;
-			}
-				
-			const auto &glyphInfo = glyphInfoIt->second;
-			if( glyphInfo.mTextureIndex != texIdx ) {
-				continue;
-			}
+	if( nullptr != bounds ) {
+		*bounds = placedGlyphs.mBounds + baselineIn;
+	}
 
-			const auto &originOffset = glyphInfo.mOriginOffset;
-
-			Rectf srcTexCoords = curTex->getAreaTexCoords( glyphInfo.mTexCoords );
-			Rectf destRect = Rectf( glyphInfo.mTexCoords );
-			destRect.scale( scale );
-			destRect -= destRect.getUpperLeft();
-			vec2 offset = vec2( 0, -( destRect.getHeight() ) );
-			// Reverse the transformation applied during SDF generation
-			float tx = sdfPadding.x;
-			float ty = std::fabs( originOffset.y ) + sdfPadding.y;
-			offset += scale * sdfScale * vec2( -tx, ty );
-			// Use origin scale for horizontal offset
-            offset += scale * fontOriginScale * vec2( glm::max( originOffset.x, 0.0f ), 0.0f );
-            destRect += offset;
-			destRect.scale( fontRenderScale );
-
-			destRect += glyphIt->second * scale;
-			destRect += baseline;
-			
-			SdfText::CharPlacement place = {};
-			place.mGlyph = glyphIt->first;
-			place.mSrcTexCoords = srcTexCoords;
-			place.mDstRect = destRect;
-			charPlacements.push_back( place );
-		}
+	return result;
+}
 
-		if( ! charPlacements.empty() ) {
-			result.push_back( std::make_pair( static_cast<uint8_t>( texIdx ), charPlacements ) );
+SdfText::Font::GlyphMeasuresList SdfText::layoutString( const std::string &str, const ivec2 &boxSize, const DrawOptions &options ) const
+{
+	LayoutCache::Key key;
+	if( mLayoutCache ) {
+		key.mStrHash = hashBytes( str.data(), str.size() );
+		key.mOptionsHash = hashLayoutOptions( boxSize, options );
+		key.mStr = &str;
+		const SdfText::Font::GlyphMeasuresList *glyphMeasures = mLayoutCache->find( key );
+		if( nullptr != glyphMeasures ) {
+			return *glyphMeasures;
 		}
 	}
 
+	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( boxSize ).ligate( options.getLigate() ).tracking( options.getTracking() );
+	SdfText::Font::GlyphMeasuresList result = tbox.measureGlyphs( options );
+	if( mLayoutCache ) {
+		mLayoutCache->insert( key, result );
+	}
 	return result;
 }
 
-std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> SdfText::placeString( const std::string &str, const vec2 &baseline, const DrawOptions &options )
+std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> SdfText::placeString( const std::string &str, const vec2 &baseline, const DrawOptions &options, Rectf *bounds )
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( SdfTextBox::GROW, SdfTextBox::GROW ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	SdfText::Font::GlyphMeasuresList glyphMeasures = tbox.measureGlyphs( options );
-	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> result = placeChars( glyphMeasures, baseline, options );
+	SdfText::Font::GlyphMeasuresList glyphMeasures = layoutString( str, ivec2( SdfTextBox::GROW, SdfTextBox::GROW ), options );
+	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> result = placeChars( glyphMeasures, baseline, options, bounds );
 	return result;
 }
 
-std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> SdfText::placeStringWrapped( const std::string &str, const Rectf &fitRect, const vec2 &offset, const DrawOptions &options )
+std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> SdfText::placeStringWrapped( const std::string &str, const Rectf &fitRect, const vec2 &offset, const DrawOptions &options, Rectf *bounds )
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( (int)fitRect.getWidth(), (int)fitRect.getHeight() ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	SdfText::Font::GlyphMeasuresList glyphMeasures = tbox.measureGlyphs( options );
-	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> result = placeChars( glyphMeasures, fitRect.getUpperLeft() + offset, options );
+	SdfText::Font::GlyphMeasuresList glyphMeasures = layoutString( str, ivec2( (int)fitRect.getWidth(), (int)fitRect.getHeight() ), options );
+	std::vector<std::pair<uint8_t, std::vector<SdfText::CharPlacement>>> result = placeChars( glyphMeasures, fitRect.getUpperLeft() + offset, options, bounds );
 	return result;
 }
 
 Rectf SdfText::measureStringImpl( const std::string &str, bool wrapped, const Rectf &fitRect, const DrawOptions &options ) const
 {
-	SdfTextBox tbox = wrapped ? SdfTextBox( this ).text( str ).size( (int)fitRect.getWidth(), (int)fitRect.getHeight() ).ligate( options.getLigate() ).tracking( options.getTracking() )
-                              : SdfTextBox( this ).text( str ).size( SdfTextBox::GROW, SdfTextBox::GROW ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	
-    SdfText::Font::GlyphMeasuresList glyphMeasures = tbox.measureGlyphs( options );
+	const ivec2 boxSize = wrapped ? ivec2( (int)fitRect.getWidth(), (int)fitRect.getHeight() ) : ivec2( SdfTextBox::GROW, SdfTextBox::GROW );
+    SdfText::Font::GlyphMeasuresList glyphMeasures = layoutString( str, boxSize, options );
 
-	const SdfText::Font::GlyphInfoMap& glyphMap = mTextureAtlases->mGlyphInfo;
-	const auto& sdfScale = mTextureAtlases->mSdfScale;
-	const auto& sdfPadding = mTextureAtlases->mSdfPadding;
-	const vec2 fontRenderScale = vec2( mFont.getSize() ) / ( 32.0f * mTextureAtlases->mSdfScale );
-	const vec2 fontOriginScale = vec2( mFont.getSize() ) / 32.0f;
-	const float scale = options.getScale();
+	PlacedGlyphs placedGlyphs;
+	placeGlyphs( glyphMeasures, options, &placedGlyphs, true );
+	return placedGlyphs.mBounds;
+}
 
-	Rectf result = Rectf( 0, 0, 0, 0 );
-    for( std::vector<std::pair<SdfText::Font::Glyph,vec2> >::const_iterator glyphIt = glyphMeasures.begin(); glyphIt != glyphMeasures.end(); ++glyphIt ) {
-        SdfText::Font::GlyphInfoMap::const_iterator glyphInfoIt = glyphMap.find( glyphIt->first );
-        if(  glyphInfoIt == glyphMap.end() ) {
-            continue;
-        }
+std::vector<vec2> SdfText::measureStringsImpl( const std::vector<std::string> &strs, bool wrapped, const Rectf &fitRect, const DrawOptions &options, int numThreads ) const
+{
+	const ivec2 boxSize = wrapped ? ivec2( (int)fitRect.getWidth(), (int)fitRect.getHeight() ) : ivec2( SdfTextBox::GROW, SdfTextBox::GROW );
+	std::vector<vec2> result( strs.size() );
 
-		const auto &glyphInfo = glyphInfoIt->second;          
-        const auto &originOffset = glyphInfo.mOriginOffset;
-		const auto &size = glyphInfo.mSize;
+	// New characters are resolved up front, after that the layouts only read the SdfText
+	for( const auto &str : strs ) {
+		resolveChars( str );
+	}
 
-        Rectf destRect = Rectf( glyphInfo.mTexCoords );
-        destRect.scale( scale );
-        destRect -= destRect.getUpperLeft();
-        vec2 offset = vec2( 0, -( destRect.getHeight() ) );
-        // Reverse the transformation applied during SDF generation
-        float tx = sdfPadding.x;
-        float ty = std::fabs( originOffset.y ) + sdfPadding.y;
-        offset += scale * sdfScale * vec2( -tx, ty );
-        // Use origin scale for horizontal offset
-        offset += scale * fontOriginScale * vec2( glm::max( originOffset.x, 0.0f ), 0.0f );
-        destRect += offset;
-        destRect.scale( fontRenderScale );
+	// Repeated strings are laid out once and copied afterwards
+	struct StrHash {
+		size_t operator()( const std::string *str ) const { return static_cast<size_t>( hashBytes( str->data(), str->size() ) ); }
+	};
+	struct StrEqual {
+		bool operator()( const std::string *a, const std::string *b ) const { return *a == *b; }
+	};
+	std::unordered_map<const std::string *, size_t, StrHash, StrEqual> firstIndices;
+	std::vector<std::pair<size_t, size_t>> repeats;
+
+	// The layout cache isn't thread-safe, it's consulted before and filled after the workers run
+	std::vector<size_t> strIndices;
+	std::vector<LayoutCache::Key> keys;
+	PlacedGlyphs cachedPlacedGlyphs;
+	for( size_t i = 0; i < strs.size(); ++i ) {
+		auto firstIt = firstIndices.find( &strs[i] );
+		if( firstIndices.end() != firstIt ) {
+			repeats.push_back( std::make_pair( i, firstIt->second ) );
+			continue;
+		}
+		firstIndices[&strs[i]] = i;
+
+		if( mLayoutCache ) {
+			LayoutCache::Key key;
+			key.mStrHash = hashBytes( strs[i].data(), strs[i].size() );
+			key.mOptionsHash = hashLayoutOptions( boxSize, options );
+			key.mStr = &strs[i];
+			const SdfText::Font::GlyphMeasuresList *glyphMeasures = mLayoutCache->find( key );
+			if( nullptr != glyphMeasures ) {
+				placeGlyphs( *glyphMeasures, options, &cachedPlacedGlyphs, true );
+				result[i] = vec2( cachedPlacedGlyphs.mBounds.getWidth(), cachedPlacedGlyphs.mBounds.getHeight() );
+				continue;
+			}
+			keys.push_back( key );
+		}
+		strIndices.push_back( i );
+	}
 
-		destRect += glyphIt->second * scale;
+	std::vector<SdfText::Font::GlyphMeasuresList> newLayouts( mLayoutCache ? strIndices.size() : 0 );
+	std::atomic<size_t> nextStr( 0 );
+	auto measureWorker = [&]() {
+		// Every worker lays out into buffers of its own, grown once for its whole share of the batch
+		SdfTextBox tbox = SdfTextBox( this ).size( boxSize ).ligate( options.getLigate() ).tracking( options.getTracking() );
+		SdfTextBox::LayoutBuffers buffers;
+		SdfText::Font::GlyphMeasuresList glyphMeasures;
+		PlacedGlyphs placedGlyphs;
+		for( size_t j = nextStr++; j < strIndices.size(); j = nextStr++ ) {
+			tbox.setText( strs[strIndices[j]] );
+			tbox.measureGlyphs( options, &buffers, &glyphMeasures );
+			placeGlyphs( glyphMeasures, options, &placedGlyphs, true );
+			result[strIndices[j]] = vec2( placedGlyphs.mBounds.getWidth(), placedGlyphs.mBounds.getHeight() );
+			if( ! newLayouts.empty() ) {
+				newLayouts[j] = glyphMeasures;
+			}
+		}
+	};
 
-		destRect.x1 += ( ( sdfPadding.x + originOffset.x ) * fontOriginScale.x );
-		destRect.y2 -= ( sdfPadding.y * fontOriginScale.y );
-		destRect.x2 = destRect.x1 + ( ( size.x + 1.0f ) * fontOriginScale.x );
-		destRect.y1 = destRect.y2 - ( ( size.y + 1.0f ) * fontOriginScale.y );
-		destRect.x1 -= ( 0.5f * fontOriginScale.x );
-		destRect.y1 -= ( 0.5f * fontOriginScale.y );
-		destRect.x2 += ( 0.5f * fontOriginScale.x );
-		destRect.y2 += ( 0.5f * fontOriginScale.y );
+	// Threads only pay off for batches of a few dozen strings each
+	const size_t minStrsPerThread = 32;
+	size_t numWorkers = ( numThreads > 0 ) ? static_cast<size_t>( numThreads ) : static_cast<size_t>( std::thread::hardware_concurrency() );
+	numWorkers = std::max<size_t>( 1, std::min<size_t>( numWorkers, strIndices.size() / minStrsPerThread ) );
 
-		if( ( result.getWidth() > 0 ) || ( result.getHeight() > 0 ) ) {
-			result.x1 = std::min( result.x1, destRect.x1 );
-			result.y1 = std::min( result.y1, destRect.y1 );
-			result.x2 = std::max( result.x2, destRect.x2 );
-			result.y2 = std::max( result.y2, destRect.y2 );
-		}
-		else {
-			result = destRect;
-		}
+	std::vector<std::thread> workers;
+	for( size_t i = 1; i < numWorkers; ++i ) {
+		workers.push_back( std::thread( measureWorker ) );
+	}
+	measureWorker();
+	for( auto& worker : workers ) {
+		worker.join();
+	}
+
+	for( size_t j = 0; j < newLayouts.size(); ++j ) {
+		mLayoutCache->insert( keys[j], newLayouts[j] );
+	}
+
+	for( const auto &repeat : repeats ) {
+		result[repeat.first] = result[repeat.second];
 	}
 
 	return result;
@@ -2507,22 +4509,29 @@ vec2 SdfText::measureStringWrapped( const std::string &str, const Rectf &fitRect
 	return result;
 }
 
+std::vector<vec2> SdfText::measureStrings( const std::vector<std::string> &strs, const DrawOptions &options, int numThreads ) const
+{
+	return measureStringsImpl( strs, false, Rectf( 0, 0, 0, 0 ), options, numThreads );
+}
+
+std::vector<vec2> SdfText::measureStringsWrapped( const std::vector<std::string> &strs, const Rectf &fitRect, const DrawOptions &options, int numThreads ) const
+{
+	return measureStringsImpl( strs, true, fitRect, options, numThreads );
+}
+
 std::vector<std::pair<SdfText::Font::Glyph, vec2>> SdfText::getGlyphPlacements( const std::string &str, const DrawOptions &options ) const
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( SdfTextBox::GROW, SdfTextBox::GROW ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	return tbox.measureGlyphs(  options );
+	return layoutString( str, ivec2( SdfTextBox::GROW, SdfTextBox::GROW ), options );
 }
 
 std::vector<std::pair<SdfText::Font::Glyph, vec2>> SdfText::getGlyphPlacements( const std::string &str, const Rectf &fitRect, const DrawOptions &options ) const
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( SdfTextBox::GROW, (int)fitRect.getHeight() ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	return tbox.measureGlyphs( options );
+	return layoutString( str, ivec2( SdfTextBox::GROW, (int)fitRect.getHeight() ), options );
 }
 
 std::vector<std::pair<SdfText::Font::Glyph, vec2>> SdfText::getGlyphPlacementsWrapped( const std::string &str, const Rectf &fitRect, const DrawOptions &options ) const
 {
-	SdfTextBox tbox = SdfTextBox( this ).text( str ).size( (int)fitRect.getWidth(), (int)fitRect.getHeight() ).ligate( options.getLigate() ).tracking( options.getTracking() );
-	return tbox.measureGlyphs( options );
+	return layoutString( str, ivec2( (int)fitRect.getWidth(), (int)fitRect.getHeight() ), options );
 }
 
 std::string SdfText::defaultChars()
@@ -2550,25 +4559,74 @@ std::string SdfText::defaultChars()
 
 uint32_t SdfText::getNumTextures() const
 {
-	return static_cast<uint32_t>( mTextureAtlases->mTextures.size() );
+	return static_cast<uint32_t>( mTextureAtlases->mPages->mTextures.size() );
 }
 
 const gl::TextureRef& SdfText::getTexture(uint32_t n) const
 {
-	return mTextureAtlases->mTextures[static_cast<size_t>( n )];
+	return mTextureAtlases->mPages->mTextures[static_cast<size_t>( n )];
+}
+
+bool SdfText::isSingleChannel() const
+{
+	return 1 == mTextureAtlases->mNumChannels;
+}
+
+float SdfText::getTextureOccupancy() const
+{
+	return mTextureAtlases->calculateOccupancy();
+}
+
+void SdfText::setTextureMemoryBudget( size_t bytes )
+{
+	SdfTextManager::instance()->setTextureMemoryBudget( bytes );
+}
+
+size_t SdfText::getTextureMemoryBudget()
+{
+	return SdfTextManager::instance()->getTextureMemoryBudget();
+}
+
+size_t SdfText::getTextureMemoryUsage()
+{
+	return SdfTextManager::instance()->getTextureMemoryUsage();
+}
+
+void SdfText::setLayoutCacheSize( size_t numLayouts )
+{
+	if( 0 == numLayouts ) {
+		mLayoutCache.reset();
+	}
+	else if( mLayoutCache ) {
+		mLayoutCache->setCapacity( numLayouts );
+	}
+	else {
+		mLayoutCache.reset( new LayoutCache( numLayouts ) );
+	}
+}
+
+size_t SdfText::getLayoutCacheSize() const
+{
+	return mLayoutCache ? mLayoutCache->getCapacity() : 0;
 }
 
-gl::GlslProgRef SdfText::defaultShader()
+gl::GlslProgRef SdfText::defaultShader( bool singleChannel )
 {
-	if( ! sDefaultShader ) {
+	gl::GlslProgRef &shader = singleChannel ? sDefaultSingleChannelShader : sDefaultShader;
+	if( ! shader ) {
 		try {
-			sDefaultShader = gl::GlslProg::create( kSdfVertShader, kSdfFragShader );
+			std::string fragShader = kSdfFragShader;
+			if( singleChannel ) {
+				// Right after the #version line
+				fragShader.insert( fragShader.find( '\n' ) + 1, "#define SINGLE_CHANNEL\n" );
+			}
+			shader = gl::GlslProg::create( kSdfVertShader, fragShader );
 		}
 		catch( const std::exception& e ) {
 			CI_LOG_E( "SdfText::defaultShader error: " << e.what() );
 		}
 	}
-	return sDefaultShader;
+	return shader;
 }
 
 }} // namespace cinder::gl
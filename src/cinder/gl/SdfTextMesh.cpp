@@ -228,6 +228,7 @@ struct ClientMesh {
 
 	std::vector<Tri>		mTriangles;
 	std::vector<Vertex>		mVertices;
+	bool					mSingleChannel = false;
 
 	uint32_t getNumTriangles() const {
 		return static_cast<uint32_t>( mTriangles.size() );
@@ -270,22 +271,13 @@ void SdfTextMesh::cache()
 		return;
 	}
 
+	// Meshes are gathered per texture across all the fonts
+	std::unordered_map<Texture2dRef, ClientMesh> texToMesh;
 	for( auto &runMapIt : mRunMaps ) {
 		auto &sdfText = runMapIt.first;
 		auto &runs = runMapIt.second;
 
-		// Get textures
-		std::vector<Texture2dRef> textures;
-		{
-			uint32_t numTextures = sdfText->getNumTextures();
-			for( uint32_t i = 0; i < numTextures; ++i ) {
-				auto tex = sdfText->getTexture( i );
-				textures.push_back( sdfText->getTexture( i ) );
-			}
-		}
-
 		std::unordered_map<RunRef, std::pair<uint32_t, uint32_t>> runVertRanges;
-		std::unordered_map<Texture2dRef, ClientMesh> texToMesh;
 		for( const auto &run : runs ) {
 			std::pair<uint32_t, uint32_t> vertRange = std::make_pair( 0, 0 );
 			const auto &options = run->getOptions();	
@@ -294,25 +286,22 @@ void SdfTextMesh::cache()
 			if( run->getWrapped() ) {
 				const Rectf &fitRect = run->getFitRect();
 				vec2 offset = vec2( run->getPosition() );
-				placements = sdfText->placeStringWrapped( run->getUtf8(), fitRect, offset, options.getDrawOptions() );
-				bounds = sdfText->measureStringBoundsWrapped( run->getUtf8(), fitRect, options.getDrawOptions() );
-				bounds += vec2( fitRect.x1, fitRect.y1 );
-				bounds += offset;
+				placements = sdfText->placeStringWrapped( run->getUtf8(), fitRect, offset, options.getDrawOptions(), &bounds );
 			}
 			else {
 				vec2 baseline = vec2( run->getBaseline() );
-				placements = sdfText->placeString( run->getUtf8(), baseline, options.getDrawOptions() );
-				bounds = sdfText->measureStringBounds( run->getUtf8(),options.getDrawOptions() );
-				bounds += baseline;
+				placements = sdfText->placeString( run->getUtf8(), baseline, options.getDrawOptions(), &bounds );
 			}
 			for( const auto &placementsIt : placements ) {
-				Texture2dRef tex = textures[placementsIt.first];
+				// Placing may have baked glyphs onto a new page of a dynamic atlas, so the textures are looked up afterwards
+				Texture2dRef tex = sdfText->getTexture( placementsIt.first );
 				const auto& charPlacements = placementsIt.second;
 				if( charPlacements.empty() ) {
 					continue;
 				}
 
 				auto &mesh = texToMesh[tex];
+				mesh.mSingleChannel = sdfText->isSingleChannel();
 				vertRange.first = static_cast<uint32_t>( mesh.getNumIndices() );
 				for( const auto& place : charPlacements ) {
 					const auto& srcTexCoords = place.mSrcTexCoords;
@@ -342,34 +331,38 @@ void SdfTextMesh::cache()
 				runVertRanges[run] = vertRange;
 			}
 		}
+	}
 
-		auto& textDraws = mTextDrawMaps[sdfText];
-		for( const auto& tmIt : texToMesh ) {
-			auto& tex = tmIt.first;
-			auto& mesh = tmIt.second;
-			auto& textBatch = textDraws->mTextBatches[tex];
-
-			if( ! textBatch.mBatch ) {
-				// Create index buffer
-				textBatch.mIndexBuffer = Vbo::create( GL_ELEMENT_ARRAY_BUFFER );
-				// Create vertex layout
-				auto vertexLayout = geom::BufferLayout();
-				vertexLayout.append( geom::POSITION,    4, sizeof( ClientMesh::Vertex ), static_cast<size_t>( offsetof( ClientMesh::Vertex, pos ) ) );
-				vertexLayout.append( geom::TEX_COORD_0, 2, sizeof( ClientMesh::Vertex ), static_cast<size_t>( offsetof( ClientMesh::Vertex, uv  ) ) );
-				// Create Vertex buffer
-				textBatch.mVertexBuffer = Vbo::create( GL_ARRAY_BUFFER );
-				// Create vbo mesh - index count is passed in to prevent data corruption on NVIDIA cards
-				VboMeshRef vboMesh = VboMesh::create( 0, GL_TRIANGLES, { std::make_pair( vertexLayout, textBatch.mVertexBuffer  ) }, mesh.getNumIndices(), GL_UNSIGNED_INT, textBatch.mIndexBuffer );
-				// Create batch using vbo mesh and default SdfText sahder
-				textBatch.mBatch = Batch::create( vboMesh, SdfText::defaultShader() );
-			}
+	// Textures no longer drawn keep their buffers but draw nothing
+	for( auto& textBatchIt : mTextBatches ) {
+		textBatchIt.second.mIndexCount = 0;
+	}
 
-			// Buffer index and vertex data
-			textBatch.mIndexBuffer->bufferData( sizeof( uint32_t ) * mesh.getNumIndices(), mesh.getIndicesData(), GL_STATIC_DRAW );
-			textBatch.mVertexBuffer->bufferData( sizeof( ClientMesh::Vertex ) * mesh.getNumVertices(), mesh.getVerticesData(), GL_STATIC_DRAW );
-			// Update Index count
-			textBatch.mIndexCount = mesh.getNumIndices();
+	for( const auto& tmIt : texToMesh ) {
+		auto& tex = tmIt.first;
+		auto& mesh = tmIt.second;
+		auto& textBatch = mTextBatches[tex];
+
+		if( ! textBatch.mBatch ) {
+			// Create index buffer
+			textBatch.mIndexBuffer = Vbo::create( GL_ELEMENT_ARRAY_BUFFER );
+			// Create vertex layout
+			auto vertexLayout = geom::BufferLayout();
+			vertexLayout.append( geom::POSITION,    4, sizeof( ClientMesh::Vertex ), static_cast<size_t>( offsetof( ClientMesh::Vertex, pos ) ) );
+			vertexLayout.append( geom::TEX_COORD_0, 2, sizeof( ClientMesh::Vertex ), static_cast<size_t>( offsetof( ClientMesh::Vertex, uv  ) ) );
+			// Create Vertex buffer
+			textBatch.mVertexBuffer = Vbo::create( GL_ARRAY_BUFFER );
+			// Create vbo mesh - index count is passed in to prevent data corruption on NVIDIA cards
+			VboMeshRef vboMesh = VboMesh::create( 0, GL_TRIANGLES, { std::make_pair( vertexLayout, textBatch.mVertexBuffer  ) }, mesh.getNumIndices(), GL_UNSIGNED_INT, textBatch.mIndexBuffer );
+			// Create batch using vbo mesh and default SdfText sahder
+			textBatch.mBatch = Batch::create( vboMesh, SdfText::defaultShader( mesh.mSingleChannel ) );
 		}
+
+		// Buffer index and vertex data
+		textBatch.mIndexBuffer->bufferData( sizeof( uint32_t ) * mesh.getNumIndices(), mesh.getIndicesData(), GL_STATIC_DRAW );
+		textBatch.mVertexBuffer->bufferData( sizeof( ClientMesh::Vertex ) * mesh.getNumVertices(), mesh.getVerticesData(), GL_STATIC_DRAW );
+		// Update Index count
+		textBatch.mIndexCount = mesh.getNumIndices();
 	}
 
 	mDirty = false;
@@ -379,25 +372,26 @@ void SdfTextMesh::draw( bool premultiply, float gamma )
 {
 	cache();
 
-	for( auto& textDrawIt : mTextDrawMaps ) {
-		auto& textDraw = textDrawIt.second;
-		for( auto& textBatchIt : textDraw->mTextBatches ) {
-			auto& tex = textBatchIt.first;
-			auto& textBatch = textBatchIt.second;
-			auto& batch = textBatch.mBatch;
-			auto& shader = batch->getGlslProg();
+	for( auto& textBatchIt : mTextBatches ) {
+		auto& tex = textBatchIt.first;
+		auto& textBatch = textBatchIt.second;
+		if( 0 == textBatch.mIndexCount ) {
+			continue;
+		}
 
+		auto& batch = textBatch.mBatch;
+		auto& shader = batch->getGlslProg();
 
-			ScopedTextureBind scopedTexture( tex, 0 );
-			shader->uniform( "uTex0", 0 );
 
-			shader->uniform( "uFgColor", gl::context()->getCurrentColor() );
-			shader->uniform( "uPremultiply", premultiply ? 1.0f : 0.0f );
-			shader->uniform( "uGamma", gamma );
+		ScopedTextureBind scopedTexture( tex, 0 );
+		shader->uniform( "uTex0", 0 );
 
+		shader->uniform( "uFgColor", gl::context()->getCurrentColor() );
+		shader->uniform( "uPremultiply", premultiply ? 1.0f : 0.0f );
+		shader->uniform( "uGamma", gamma );
 
-			batch->draw( 0, textBatch.mIndexCount );
-		}
+
+		batch->draw( 0, textBatch.mIndexCount );
 	}
 }
 
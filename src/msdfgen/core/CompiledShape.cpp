@@ -0,0 +1,150 @@
+
+#include "msdfgen/core/CompiledShape.h"
+
+namespace msdfgen {
+
+CompiledShape::CompiledShape() : inverseYAxis(false) { }
+
+CompiledShape::CompiledShape(const Shape &shape) : inverseYAxis(shape.inverseYAxis) {
+    for (std::vector<Contour>::const_iterator contour = shape.contours.begin(); contour != shape.contours.end(); ++contour)
+        for (std::vector<EdgeHolder>::const_iterator edge = contour->edges.begin(); edge != contour->edges.end(); ++edge) {
+            const EdgeSegment *segment = *edge;
+            if (const LinearSegment *linear = dynamic_cast<const LinearSegment *>(segment)) {
+                edgeTypes.push_back(LINEAR);
+                edgeOffsets.push_back(int(linearPoints.size()));
+                linearPoints.insert(linearPoints.end(), linear->p, linear->p+2);
+                for (int i = 0; i < 2; ++i)
+                    linearFloatPoints.push_back(FloatPoint2(linear->p[i]));
+            } else if (const QuadraticSegment *quadratic = dynamic_cast<const QuadraticSegment *>(segment)) {
+                edgeTypes.push_back(QUADRATIC);
+                edgeOffsets.push_back(int(quadraticPoints.size()));
+                quadraticPoints.insert(quadraticPoints.end(), quadratic->p, quadratic->p+3);
+                for (int i = 0; i < 3; ++i)
+                    quadraticFloatPoints.push_back(FloatPoint2(quadratic->p[i]));
+            } else if (const CubicSegment *cubic = dynamic_cast<const CubicSegment *>(segment)) {
+                edgeTypes.push_back(CUBIC);
+                edgeOffsets.push_back(int(cubicPoints.size()));
+                cubicPoints.insert(cubicPoints.end(), cubic->p, cubic->p+4);
+                for (int i = 0; i < 4; ++i)
+                    cubicFloatPoints.push_back(FloatPoint2(cubic->p[i]));
+            } else {
+                edgeTypes.push_back(OTHER);
+                edgeOffsets.push_back(int(otherSegments.size()));
+                otherSegments.push_back(segment);
+            }
+            edgeColors.push_back(segment->color);
+            Bounds bounds;
+            bounds.l = bounds.b = 1e240;
+            bounds.r = bounds.t = -1e240;
+            segment->bounds(bounds.l, bounds.b, bounds.r, bounds.t);
+            edgeBounds.push_back(bounds);
+        }
+}
+
+int CompiledShape::edgeCount() const {
+    return int(edgeTypes.size());
+}
+
+SignedDistance CompiledShape::signedDistance(int edge, Point2 origin, double &param) const {
+    switch (edgeTypes[edge]) {
+        case LINEAR:
+            return LinearSegment::signedDistance(&linearPoints[edgeOffsets[edge]], origin, param);
+        case QUADRATIC:
+            return QuadraticSegment::signedDistance(&quadraticPoints[edgeOffsets[edge]], origin, param);
+        case CUBIC:
+            return CubicSegment::signedDistance(&cubicPoints[edgeOffsets[edge]], origin, param);
+        default:
+            return otherSegments[edgeOffsets[edge]]->signedDistance(origin, param);
+    }
+}
+
+void CompiledShape::signedDistances(int edge, const Point2 *origins, SignedDistance *distances, double *params) const {
+    switch (edgeTypes[edge]) {
+        case LINEAR:
+            LinearSegment::signedDistances(&linearPoints[edgeOffsets[edge]], origins, distances, params);
+            break;
+        case QUADRATIC:
+            QuadraticSegment::signedDistances(&quadraticPoints[edgeOffsets[edge]], origins, distances, params);
+            break;
+        case CUBIC:
+            CubicSegment::signedDistances(&cubicPoints[edgeOffsets[edge]], origins, distances, params);
+            break;
+        default:
+            otherSegments[edgeOffsets[edge]]->signedDistances(origins, distances, params);
+    }
+}
+
+void CompiledShape::signedDistancesFloat(int edge, const Point2 *origins, SignedDistance *distances, double *params) const {
+    switch (edgeTypes[edge]) {
+        case LINEAR:
+            LinearSegment::signedDistancesFloat(&linearFloatPoints[edgeOffsets[edge]], origins, distances, params);
+            break;
+        case QUADRATIC:
+            QuadraticSegment::signedDistancesFloat(&quadraticFloatPoints[edgeOffsets[edge]], origins, distances, params);
+            break;
+        case CUBIC:
+            CubicSegment::signedDistancesFloat(&cubicFloatPoints[edgeOffsets[edge]], origins, distances, params);
+            break;
+        default:
+            for (int i = 0; i < MSDFGEN_FLOAT_BATCH_SIZE; i += MSDFGEN_BATCH_SIZE)
+                otherSegments[edgeOffsets[edge]]->signedDistances(origins+i, distances+i, params+i);
+    }
+}
+
+void CompiledShape::distanceToPseudoDistance(int edge, SignedDistance &distance, Point2 origin, double param) const {
+    if (!(param < 0 || param > 1))
+        return;
+    double end = param < 0 ? 0 : 1;
+    switch (edgeTypes[edge]) {
+        case LINEAR: {
+            const Point2 *p = &linearPoints[edgeOffsets[edge]];
+            EdgeSegment::distanceToPseudoDistance(distance, origin, param, LinearSegment::point(p, end), LinearSegment::direction(p, end));
+            break;
+        }
+        case QUADRATIC: {
+            const Point2 *p = &quadraticPoints[edgeOffsets[edge]];
+            EdgeSegment::distanceToPseudoDistance(distance, origin, param, QuadraticSegment::point(p, end), QuadraticSegment::direction(p, end));
+            break;
+        }
+        case CUBIC: {
+            const Point2 *p = &cubicPoints[edgeOffsets[edge]];
+            EdgeSegment::distanceToPseudoDistance(distance, origin, param, CubicSegment::point(p, end), CubicSegment::direction(p, end));
+            break;
+        }
+        default:
+            otherSegments[edgeOffsets[edge]]->distanceToPseudoDistance(distance, origin, param);
+    }
+}
+
+int CompiledShape::scanlineIntersections(int edge, double x[3], int dy[3], double y) const {
+    switch (edgeTypes[edge]) {
+        case LINEAR:
+            return LinearSegment::scanlineIntersections(&linearPoints[edgeOffsets[edge]], x, dy, y);
+        case QUADRATIC:
+            return QuadraticSegment::scanlineIntersections(&quadraticPoints[edgeOffsets[edge]], x, dy, y);
+        case CUBIC:
+            return CubicSegment::scanlineIntersections(&cubicPoints[edgeOffsets[edge]], x, dy, y);
+        default:
+            return otherSegments[edgeOffsets[edge]]->scanlineIntersections(x, dy, y);
+    }
+}
+
+void CompiledShape::scanline(Scanline &line, double y) const {
+    std::vector<Scanline::Intersection> intersections;
+    for (int edge = 0; edge < edgeCount(); ++edge) {
+        double x[3];
+        int dy[3];
+        int n = scanlineIntersections(edge, x, dy, y);
+        for (int i = 0; i < n; ++i) {
+            Scanline::Intersection intersection = { x[i], dy[i] };
+            intersections.push_back(intersection);
+        }
+    }
+#ifdef MSDFGEN_USE_CPP11
+    line.setIntersections((std::vector<Scanline::Intersection> &&) intersections);
+#else
+    line.setIntersections(intersections);
+#endif
+}
+
+}
@@ -3,6 +3,14 @@
 
 namespace msdfgen {
 
+Contour::Contour() { }
+
+Contour::Contour(const Contour &orig, EdgeArena *arena) {
+    edges.reserve(orig.edges.size());
+    for (std::vector<EdgeHolder>::const_iterator edge = orig.edges.begin(); edge != orig.edges.end(); ++edge)
+        edges.push_back(EdgeHolder(*edge, arena));
+}
+
 void Contour::addEdge(const EdgeHolder &edge) {
     edges.push_back(edge);
 }
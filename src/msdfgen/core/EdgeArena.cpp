@@ -0,0 +1,48 @@
+
+#include "msdfgen/core/EdgeArena.h"
+
+#include <new>
+
+namespace msdfgen {
+
+// Alignment of every allocation, which is at least that of double and of the vtable pointer.
+#define MSDFGEN_EDGE_ARENA_ALIGNMENT 16
+
+EdgeArena::EdgeArena(size_t blockSize) : blockSize(blockSize), currentBlock(0), offset(0) { }
+
+EdgeArena::~EdgeArena() {
+    for (std::vector<Block>::iterator block = blocks.begin(); block != blocks.end(); ++block)
+        ::operator delete(block->data);
+}
+
+void * EdgeArena::allocate(size_t size) {
+    size = (size+MSDFGEN_EDGE_ARENA_ALIGNMENT-1)&~size_t(MSDFGEN_EDGE_ARENA_ALIGNMENT-1);
+    // Move on to the next block that has room, allocating a new one if there is none
+    while (currentBlock < blocks.size() && offset+size > blocks[currentBlock].size)
+        ++currentBlock, offset = 0;
+    if (currentBlock == blocks.size()) {
+        Block block;
+        block.size = size > blockSize ? size : blockSize;
+        block.data = static_cast<char *>(::operator new(block.size));
+        blocks.push_back(block);
+        offset = 0;
+    }
+    void *result = blocks[currentBlock].data+offset;
+    offset += size;
+    return result;
+}
+
+void EdgeArena::reset() {
+    currentBlock = 0;
+    offset = 0;
+}
+
+bool EdgeArena::contains(const void *ptr) const {
+    const char *p = static_cast<const char *>(ptr);
+    for (std::vector<Block>::const_iterator block = blocks.begin(); block != blocks.end(); ++block)
+        if (p >= block->data && p < block->data+block->size)
+            return true;
+    return false;
+}
+
+}
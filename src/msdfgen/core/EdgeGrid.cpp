@@ -0,0 +1,110 @@
+
+#include "msdfgen/core/EdgeGrid.h"
+
+#include "msdfgen/core/arithmetics.hpp"
+
+namespace msdfgen {
+
+// Relative padding added to edge bounds so that rounding in the distance computations can never undercut the bound.
+#define MSDFGEN_EDGE_GRID_PADDING 1e-9
+
+EdgeGrid::EdgeGrid(const CompiledShape &shape) : edgeBounds(shape.edgeBounds), pad(0), nColumns(1), nRows(1) {
+    gridBounds.l = gridBounds.b = 1e240;
+    gridBounds.r = gridBounds.t = -1e240;
+    for (std::vector<Bounds>::const_iterator eb = edgeBounds.begin(); eb != edgeBounds.end(); ++eb) {
+        gridBounds.l = min(gridBounds.l, eb->l), gridBounds.b = min(gridBounds.b, eb->b);
+        gridBounds.r = max(gridBounds.r, eb->r), gridBounds.t = max(gridBounds.t, eb->t);
+    }
+    if (edgeBounds.empty()) {
+        gridBounds.l = gridBounds.b = gridBounds.r = gridBounds.t = 0;
+        cellSize = Vector2(1);
+        cellStart.resize(2, 0);
+        return;
+    }
+
+    pad = MSDFGEN_EDGE_GRID_PADDING*(1+max(max(fabs(gridBounds.l), fabs(gridBounds.r)), max(fabs(gridBounds.b), fabs(gridBounds.t))));
+    for (std::vector<Bounds>::iterator eb = edgeBounds.begin(); eb != edgeBounds.end(); ++eb)
+        eb->l -= pad, eb->b -= pad, eb->r += pad, eb->t += pad;
+    gridBounds.l -= pad, gridBounds.b -= pad, gridBounds.r += pad, gridBounds.t += pad;
+
+    // Aim for about one edge per cell, following the aspect ratio of the shape
+    double w = gridBounds.r-gridBounds.l, h = gridBounds.t-gridBounds.b;
+    double side = sqrt(w*h/edgeBounds.size());
+    nColumns = clamp(int(ceil(w/side)), 1, 256);
+    nRows = clamp(int(ceil(h/side)), 1, 256);
+    cellSize = Vector2(w/nColumns, h/nRows);
+
+    // Bucket edges into every cell their bounds overlap (counting pass, then fill)
+    cellStart.assign(nColumns*nRows+1, 0);
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<int> fill;
+        if (pass == 1) {
+            for (int i = 0; i < nColumns*nRows; ++i)
+                cellStart[i+1] += cellStart[i];
+            cellContent.resize(cellStart[nColumns*nRows]);
+            fill.assign(cellStart.begin(), cellStart.end()-1);
+        }
+        for (size_t i = 0; i < edgeBounds.size(); ++i) {
+            int c0, r0, c1, r1;
+            cell(Point2(edgeBounds[i].l, edgeBounds[i].b), c0, r0);
+            cell(Point2(edgeBounds[i].r, edgeBounds[i].t), c1, r1);
+            for (int row = r0; row <= r1; ++row)
+                for (int column = c0; column <= c1; ++column) {
+                    int c = row*nColumns+column;
+                    if (pass == 0)
+                        ++cellStart[c+1];
+                    else
+                        cellContent[fill[c]++] = int(i);
+                }
+        }
+    }
+}
+
+int EdgeGrid::edgeCount() const {
+    return int(edgeBounds.size());
+}
+
+double EdgeGrid::edgeDistanceBound(int index, Point2 p) const {
+    const Bounds &eb = edgeBounds[index];
+    double dx = max(max(eb.l-p.x, p.x-eb.r), 0.);
+    double dy = max(max(eb.b-p.y, p.y-eb.t), 0.);
+    return sqrt(dx*dx+dy*dy);
+}
+
+int EdgeGrid::columns() const {
+    return nColumns;
+}
+
+int EdgeGrid::rows() const {
+    return nRows;
+}
+
+void EdgeGrid::cell(Point2 p, int &column, int &row) const {
+    column = clamp(int(floor((p.x-gridBounds.l)/cellSize.x)), 0, nColumns-1);
+    row = clamp(int(floor((p.y-gridBounds.b)/cellSize.y)), 0, nRows-1);
+}
+
+void EdgeGrid::cellRange(int column, int row, int &begin, int &end) const {
+    begin = cellStart[row*nColumns+column];
+    end = cellStart[row*nColumns+column+1];
+}
+
+const std::vector<int> & EdgeGrid::cellEdges() const {
+    return cellContent;
+}
+
+double EdgeGrid::outsideDistanceBound(Point2 p, int c0, int r0, int c1, int r1) const {
+    double bound = 1e240;
+    if (c0 > 0)
+        bound = min(bound, max(p.x-(gridBounds.l+c0*cellSize.x), 0.));
+    if (c1 < nColumns-1)
+        bound = min(bound, max(gridBounds.l+(c1+1)*cellSize.x-p.x, 0.));
+    if (r0 > 0)
+        bound = min(bound, max(p.y-(gridBounds.b+r0*cellSize.y), 0.));
+    if (r1 < nRows-1)
+        bound = min(bound, max(gridBounds.b+(r1+1)*cellSize.y-p.y, 0.));
+    // Cell boundaries are subject to rounding too
+    return max(bound-pad, 0.);
+}
+
+}
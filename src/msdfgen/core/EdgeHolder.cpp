@@ -3,43 +3,65 @@
 
 namespace msdfgen {
 
-EdgeHolder::EdgeHolder() : edgeSegment(NULL) { }
+/// Returns arena if the segment is allocated in it, NULL if it is on the heap. Segment types that only implement clone() and splitInThirds() without an arena put their copies and parts on the heap.
+static EdgeArena * allocatingArena(const EdgeSegment *segment, EdgeArena *arena) {
+    return arena && segment && arena->contains(segment) ? arena : NULL;
+}
+
+EdgeHolder::EdgeHolder() : edgeSegment(NULL), edgeArena(NULL) { }
 
-EdgeHolder::EdgeHolder(EdgeSegment *segment) : edgeSegment(segment) { }
+EdgeHolder::EdgeHolder(EdgeSegment *segment, EdgeArena *arena) : edgeSegment(segment), edgeArena(allocatingArena(segment, arena)) { }
 
-EdgeHolder::EdgeHolder(Point2 p0, Point2 p1, EdgeColor edgeColor) : edgeSegment(new LinearSegment(p0, p1, edgeColor)) { }
+EdgeHolder::EdgeHolder(Point2 p0, Point2 p1, EdgeColor edgeColor, EdgeArena *arena) : edgeSegment(new (arena) LinearSegment(p0, p1, edgeColor)), edgeArena(arena) { }
 
-EdgeHolder::EdgeHolder(Point2 p0, Point2 p1, Point2 p2, EdgeColor edgeColor) : edgeSegment(new QuadraticSegment(p0, p1, p2, edgeColor)) { }
+EdgeHolder::EdgeHolder(Point2 p0, Point2 p1, Point2 p2, EdgeColor edgeColor, EdgeArena *arena) : edgeSegment(new (arena) QuadraticSegment(p0, p1, p2, edgeColor)), edgeArena(arena) { }
 
-EdgeHolder::EdgeHolder(Point2 p0, Point2 p1, Point2 p2, Point2 p3, EdgeColor edgeColor) : edgeSegment(new CubicSegment(p0, p1, p2, p3, edgeColor)) { }
+EdgeHolder::EdgeHolder(Point2 p0, Point2 p1, Point2 p2, Point2 p3, EdgeColor edgeColor, EdgeArena *arena) : edgeSegment(new (arena) CubicSegment(p0, p1, p2, p3, edgeColor)), edgeArena(arena) { }
 
-EdgeHolder::EdgeHolder(const EdgeHolder &orig) : edgeSegment(orig.edgeSegment ? orig.edgeSegment->clone() : NULL) { }
+EdgeHolder::EdgeHolder(const EdgeHolder &orig) : edgeSegment(orig.edgeSegment ? orig.edgeSegment->clone(orig.edgeArena) : NULL), edgeArena(allocatingArena(edgeSegment, orig.edgeArena)) { }
+
+EdgeHolder::EdgeHolder(const EdgeHolder &orig, EdgeArena *arena) : edgeSegment(orig.edgeSegment ? orig.edgeSegment->clone(arena) : NULL), edgeArena(allocatingArena(edgeSegment, arena)) { }
 
 #ifdef MSDFGEN_USE_CPP11
-EdgeHolder::EdgeHolder(EdgeHolder &&orig) : edgeSegment(orig.edgeSegment) {
+EdgeHolder::EdgeHolder(EdgeHolder &&orig) : edgeSegment(orig.edgeSegment), edgeArena(orig.edgeArena) {
     orig.edgeSegment = NULL;
 }
 #endif
 
 EdgeHolder::~EdgeHolder() {
-    delete edgeSegment;
+    release();
 }
 
 EdgeHolder & EdgeHolder::operator=(const EdgeHolder &orig) {
-    delete edgeSegment;
-    edgeSegment = orig.edgeSegment ? orig.edgeSegment->clone() : NULL;
+    if (this != &orig) {
+        release();
+        edgeSegment = orig.edgeSegment ? orig.edgeSegment->clone(orig.edgeArena) : NULL;
+        edgeArena = allocatingArena(edgeSegment, orig.edgeArena);
+    }
     return *this;
 }
 
 #ifdef MSDFGEN_USE_CPP11
 EdgeHolder & EdgeHolder::operator=(EdgeHolder &&orig) {
-    delete edgeSegment;
-    edgeSegment = orig.edgeSegment;
-    orig.edgeSegment = NULL;
+    if (this != &orig) {
+        release();
+        edgeSegment = orig.edgeSegment;
+        edgeArena = orig.edgeArena;
+        orig.edgeSegment = NULL;
+    }
     return *this;
 }
 #endif
 
+void EdgeHolder::release() {
+    if (edgeArena) {
+        if (edgeSegment)
+            edgeSegment->~EdgeSegment();
+    } else
+        delete edgeSegment;
+    edgeSegment = NULL;
+}
+
 EdgeSegment & EdgeHolder::operator*() {
     return *edgeSegment;
 }
@@ -64,4 +86,8 @@ EdgeHolder::operator const EdgeSegment *() const {
     return edgeSegment;
 }
 
+EdgeArena * EdgeHolder::arena() const {
+    return edgeArena;
+}
+
 }
@@ -0,0 +1,71 @@
+
+#include "msdfgen/core/Scanline.h"
+
+#include <algorithm>
+
+namespace msdfgen {
+
+static bool compareIntersections(const Scanline::Intersection &a, const Scanline::Intersection &b) {
+    return a.x < b.x;
+}
+
+Scanline::Scanline() : lastIndex(0) { }
+
+void Scanline::setIntersections(const std::vector<Intersection> &intersections) {
+    this->intersections = intersections;
+    preprocess();
+}
+
+#ifdef MSDFGEN_USE_CPP11
+void Scanline::setIntersections(std::vector<Intersection> &&intersections) {
+    this->intersections = (std::vector<Intersection> &&) intersections;
+    preprocess();
+}
+#endif
+
+void Scanline::preprocess() {
+    lastIndex = 0;
+    if (!intersections.empty()) {
+        std::sort(intersections.begin(), intersections.end(), compareIntersections);
+        // Accumulate the directions so that each intersection holds the winding number right of it
+        int totalDirection = 0;
+        for (std::vector<Intersection>::iterator intersection = intersections.begin(); intersection != intersections.end(); ++intersection) {
+            totalDirection += intersection->direction;
+            intersection->direction = totalDirection;
+        }
+    }
+}
+
+/// Returns the index of the last intersection left of x, or -1 if there is none.
+int Scanline::moveTo(double x) const {
+    if (intersections.empty())
+        return -1;
+    int index = lastIndex;
+    if (x < intersections[index].x) {
+        do {
+            if (index == 0) {
+                lastIndex = 0;
+                return -1;
+            }
+            --index;
+        } while (x < intersections[index].x);
+    } else {
+        while (index < (int) intersections.size()-1 && x >= intersections[index+1].x)
+            ++index;
+    }
+    lastIndex = index;
+    return index;
+}
+
+int Scanline::sumIntersections(double x) const {
+    int index = moveTo(x);
+    if (index >= 0)
+        return intersections[index].direction;
+    return 0;
+}
+
+bool Scanline::filled(double x) const {
+    return sumIntersections(x) != 0;
+}
+
+}
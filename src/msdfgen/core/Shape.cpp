@@ -3,7 +3,15 @@
 
 namespace msdfgen {
 
-Shape::Shape() : inverseYAxis(false) { }
+Shape::Shape() : inverseYAxis(false), arena(NULL) { }
+
+Shape::Shape(EdgeArena *arena) : inverseYAxis(false), arena(arena) { }
+
+Shape::Shape(const Shape &orig, EdgeArena *arena) : inverseYAxis(orig.inverseYAxis), arena(arena) {
+    contours.reserve(orig.contours.size());
+    for (std::vector<Contour>::const_iterator contour = orig.contours.begin(); contour != orig.contours.end(); ++contour)
+        contours.push_back(Contour(*contour, arena));
+}
 
 void Shape::addContour(const Contour &contour) {
     contours.push_back(contour);
@@ -40,11 +48,11 @@ void Shape::normalize() {
     for (std::vector<Contour>::iterator contour = contours.begin(); contour != contours.end(); ++contour)
         if (contour->edges.size() == 1) {
             EdgeSegment *parts[3] = { };
-            contour->edges[0]->splitInThirds(parts[0], parts[1], parts[2]);
+            contour->edges[0]->splitInThirds(parts[0], parts[1], parts[2], arena);
             contour->edges.clear();
-            contour->edges.push_back(EdgeHolder(parts[0]));
-            contour->edges.push_back(EdgeHolder(parts[1]));
-            contour->edges.push_back(EdgeHolder(parts[2]));
+            contour->edges.push_back(EdgeHolder(parts[0], arena));
+            contour->edges.push_back(EdgeHolder(parts[1], arena));
+            contour->edges.push_back(EdgeHolder(parts[2], arena));
         }
 }
 
@@ -143,4 +143,36 @@ Vector2 operator/(double value, const Vector2 &vector) {
     return Vector2(value/vector.x, value/vector.y);
 }
 
+FloatVector2::FloatVector2(float val) : x(val), y(val) { }
+
+FloatVector2::FloatVector2(float x, float y) : x(x), y(y) { }
+
+FloatVector2::FloatVector2(const Vector2 &vector) : x(float(vector.x)), y(float(vector.y)) { }
+
+FloatVector2 FloatVector2::normalize(bool allowZero) const {
+    float len = sqrtf(x*x+y*y);
+    if (len == 0)
+        return FloatVector2(0, float(!allowZero));
+    return FloatVector2(x/len, y/len);
+}
+
+FloatVector2 FloatVector2::getOrthonormal(bool polarity, bool allowZero) const {
+    float len = sqrtf(x*x+y*y);
+    if (len == 0)
+        return polarity ? FloatVector2(0, float(!allowZero)) : FloatVector2(0, -float(!allowZero));
+    return polarity ? FloatVector2(-y/len, x/len) : FloatVector2(y/len, -x/len);
+}
+
+FloatVector2 FloatVector2::operator+(const FloatVector2 &other) const {
+    return FloatVector2(x+other.x, y+other.y);
+}
+
+FloatVector2 FloatVector2::operator-(const FloatVector2 &other) const {
+    return FloatVector2(x-other.x, y-other.y);
+}
+
+float dotProduct(const FloatVector2 &a, const FloatVector2 &b) {
+    return a.x*b.x+a.y*b.y;
+}
+
 }
@@ -57,9 +57,9 @@ void edgeColoringSimple(Shape &shape, double angleThreshold, unsigned long long
             } else if (contour->edges.size() >= 1) {
                 // Less than three edge segments for three colors => edges must be split
                 EdgeSegment *parts[7] = { };
-                contour->edges[0]->splitInThirds(parts[0+3*corner], parts[1+3*corner], parts[2+3*corner]);
+                contour->edges[0]->splitInThirds(parts[0+3*corner], parts[1+3*corner], parts[2+3*corner], shape.arena);
                 if (contour->edges.size() >= 2) {
-                    contour->edges[1]->splitInThirds(parts[3-3*corner], parts[4-3*corner], parts[5-3*corner]);
+                    contour->edges[1]->splitInThirds(parts[3-3*corner], parts[4-3*corner], parts[5-3*corner], shape.arena);
                     parts[0]->color = parts[1]->color = colors[0];
                     parts[2]->color = parts[3]->color = colors[1];
                     parts[4]->color = parts[5]->color = colors[2];
@@ -70,7 +70,7 @@ void edgeColoringSimple(Shape &shape, double angleThreshold, unsigned long long
                 }
                 contour->edges.clear();
                 for (int i = 0; parts[i]; ++i)
-                    contour->edges.push_back(EdgeHolder(parts[i]));
+                    contour->edges.push_back(EdgeHolder(parts[i], shape.arena));
             }
         }
         // Multiple corners
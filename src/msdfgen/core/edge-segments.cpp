@@ -3,35 +3,46 @@
 
 #include "msdfgen/core/arithmetics.hpp"
 #include "msdfgen/core/equation-solver.h"
+#include "msdfgen/core/simd.hpp"
 
 namespace msdfgen {
 
 void EdgeSegment::distanceToPseudoDistance(SignedDistance &distance, Point2 origin, double param) const {
-    if (param < 0) {
-        Vector2 dir = direction(0).normalize();
-        Vector2 aq = origin-point(0);
-        double ts = dotProduct(aq, dir);
-        if (ts < 0) {
-            double pseudoDistance = crossProduct(aq, dir);
-            if (fabs(pseudoDistance) <= fabs(distance.distance)) {
-                distance.distance = pseudoDistance;
-                distance.dot = 0;
-            }
-        }
-    } else if (param > 1) {
-        Vector2 dir = direction(1).normalize();
-        Vector2 bq = origin-point(1);
-        double ts = dotProduct(bq, dir);
-        if (ts > 0) {
-            double pseudoDistance = crossProduct(bq, dir);
-            if (fabs(pseudoDistance) <= fabs(distance.distance)) {
-                distance.distance = pseudoDistance;
-                distance.dot = 0;
-            }
+    if (param < 0)
+        distanceToPseudoDistance(distance, origin, param, point(0), direction(0));
+    else if (param > 1)
+        distanceToPseudoDistance(distance, origin, param, point(1), direction(1));
+}
+
+void EdgeSegment::distanceToPseudoDistance(SignedDistance &distance, Point2 origin, double param, Point2 endPoint, Vector2 endDirection) {
+    Vector2 dir = endDirection.normalize();
+    Vector2 eq = origin-endPoint;
+    double ts = dotProduct(eq, dir);
+    if (param < 0 ? ts < 0 : ts > 0) {
+        double pseudoDistance = crossProduct(eq, dir);
+        if (fabs(pseudoDistance) <= fabs(distance.distance)) {
+            distance.distance = pseudoDistance;
+            distance.dot = 0;
         }
     }
 }
 
+void EdgeSegment::signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const {
+    for (int i = 0; i < MSDFGEN_BATCH_SIZE; ++i)
+        distances[i] = signedDistance(origins[i], params[i]);
+}
+
+int EdgeSegment::scanlineIntersections(double x[3], int dy[3], double y) const {
+    int total = 0;
+    Point2 piece[2] = { point(0), Point2() };
+    for (int i = 1; i <= MSDFGEN_SCANLINE_STEPS && total < 3; ++i) {
+        piece[1] = point((double) i/MSDFGEN_SCANLINE_STEPS);
+        total += LinearSegment::scanlineIntersections(piece, x+total, dy+total, y);
+        piece[0] = piece[1];
+    }
+    return total;
+}
+
 LinearSegment::LinearSegment(Point2 p0, Point2 p1, EdgeColor edgeColor) : EdgeSegment(edgeColor) {
     p[0] = p0;
     p[1] = p1;
@@ -50,44 +61,114 @@ CubicSegment::CubicSegment(Point2 p0, Point2 p1, Point2 p2, Point2 p3, EdgeColor
     p[3] = p3;
 }
 
+void * EdgeSegment::operator new(size_t size) {
+    return ::operator new(size);
+}
+
+void * EdgeSegment::operator new(size_t size, EdgeArena *arena) {
+    return arena ? arena->allocate(size) : ::operator new(size);
+}
+
+void EdgeSegment::operator delete(void *ptr) {
+    ::operator delete(ptr);
+}
+
+void EdgeSegment::operator delete(void *ptr, EdgeArena *arena) {
+    // Only called if a constructor throws, arena memory is released with the arena
+    if (!arena)
+        ::operator delete(ptr);
+}
+
+EdgeSegment * EdgeSegment::clone() const {
+    return clone(NULL);
+}
+
+EdgeSegment * EdgeSegment::clone(EdgeArena *) const {
+    return clone();
+}
+
+void EdgeSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const {
+    splitInThirds(part1, part2, part3, NULL);
+}
+
+void EdgeSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *) const {
+    splitInThirds(part1, part2, part3);
+}
+
 LinearSegment * LinearSegment::clone() const {
-    return new LinearSegment(p[0], p[1], color);
+    return clone(NULL);
+}
+
+LinearSegment * LinearSegment::clone(EdgeArena *arena) const {
+    return new (arena) LinearSegment(p[0], p[1], color);
 }
 
 QuadraticSegment * QuadraticSegment::clone() const {
-    return new QuadraticSegment(p[0], p[1], p[2], color);
+    return clone(NULL);
+}
+
+QuadraticSegment * QuadraticSegment::clone(EdgeArena *arena) const {
+    return new (arena) QuadraticSegment(p[0], p[1], p[2], color);
 }
 
 CubicSegment * CubicSegment::clone() const {
-    return new CubicSegment(p[0], p[1], p[2], p[3], color);
+    return clone(NULL);
 }
 
-Point2 LinearSegment::point(double param) const {
+CubicSegment * CubicSegment::clone(EdgeArena *arena) const {
+    return new (arena) CubicSegment(p[0], p[1], p[2], p[3], color);
+}
+
+Point2 LinearSegment::point(const Point2 *p, double param) {
     return mix(p[0], p[1], param);
 }
 
-Point2 QuadraticSegment::point(double param) const {
+Point2 LinearSegment::point(double param) const {
+    return point(p, param);
+}
+
+Point2 QuadraticSegment::point(const Point2 *p, double param) {
     return mix(mix(p[0], p[1], param), mix(p[1], p[2], param), param);
 }
 
-Point2 CubicSegment::point(double param) const {
+Point2 QuadraticSegment::point(double param) const {
+    return point(p, param);
+}
+
+Point2 CubicSegment::point(const Point2 *p, double param) {
     Vector2 p12 = mix(p[1], p[2], param);
     return mix(mix(mix(p[0], p[1], param), p12, param), mix(p12, mix(p[2], p[3], param), param), param);
 }
 
-Vector2 LinearSegment::direction(double param) const {
+Point2 CubicSegment::point(double param) const {
+    return point(p, param);
+}
+
+Vector2 LinearSegment::direction(const Point2 *p, double param) {
     return p[1]-p[0];
 }
 
-Vector2 QuadraticSegment::direction(double param) const {
+Vector2 LinearSegment::direction(double param) const {
+    return direction(p, param);
+}
+
+Vector2 QuadraticSegment::direction(const Point2 *p, double param) {
     return mix(p[1]-p[0], p[2]-p[1], param);
 }
 
-Vector2 CubicSegment::direction(double param) const {
+Vector2 QuadraticSegment::direction(double param) const {
+    return direction(p, param);
+}
+
+Vector2 CubicSegment::direction(const Point2 *p, double param) {
     return mix(mix(p[1]-p[0], p[2]-p[1], param), mix(p[2]-p[1], p[3]-p[2], param), param);
 }
 
-SignedDistance LinearSegment::signedDistance(Point2 origin, double &param) const {
+Vector2 CubicSegment::direction(double param) const {
+    return direction(p, param);
+}
+
+SignedDistance LinearSegment::signedDistance(const Point2 *p, Point2 origin, double &param) {
     Vector2 aq = origin-p[0];
     Vector2 ab = p[1]-p[0];
     param = dotProduct(aq, ab)/dotProduct(ab, ab);
@@ -101,7 +182,11 @@ SignedDistance LinearSegment::signedDistance(Point2 origin, double &param) const
     return SignedDistance(nonZeroSign(crossProduct(aq, ab))*endpointDistance, fabs(dotProduct(ab.normalize(), eq.normalize())));
 }
 
-SignedDistance QuadraticSegment::signedDistance(Point2 origin, double &param) const {
+SignedDistance LinearSegment::signedDistance(Point2 origin, double &param) const {
+    return signedDistance(p, origin, param);
+}
+
+SignedDistance QuadraticSegment::signedDistance(const Point2 *p, Point2 origin, double &param) {
     Vector2 qa = p[0]-origin;
     Vector2 ab = p[1]-p[0];
     Vector2 br = p[0]+p[2]-p[1]-p[1];
@@ -140,7 +225,11 @@ SignedDistance QuadraticSegment::signedDistance(Point2 origin, double &param) co
         return SignedDistance(minDistance, fabs(dotProduct((p[2]-p[1]).normalize(), (p[2]-origin).normalize())));
 }
 
-SignedDistance CubicSegment::signedDistance(Point2 origin, double &param) const {
+SignedDistance QuadraticSegment::signedDistance(Point2 origin, double &param) const {
+    return signedDistance(p, origin, param);
+}
+
+SignedDistance CubicSegment::signedDistance(const Point2 *p, Point2 origin, double &param) {
     Vector2 qa = p[0]-origin;
     Vector2 ab = p[1]-p[0];
     Vector2 br = p[2]-p[1]-ab;
@@ -159,8 +248,8 @@ SignedDistance CubicSegment::signedDistance(Point2 origin, double &param) const
     for (int i = 0; i <= MSDFGEN_CUBIC_SEARCH_STARTS; ++i) {
         double t = (double) i/MSDFGEN_CUBIC_SEARCH_STARTS;
         for (int step = 0;; ++step) {
-            Vector2 qpt = point(t)-origin;
-            double distance = nonZeroSign(crossProduct(direction(t), qpt))*qpt.length();
+            Vector2 qpt = point(p, t)-origin;
+            double distance = nonZeroSign(crossProduct(direction(p, t), qpt))*qpt.length();
             if (fabs(distance) < fabs(minDistance)) {
                 minDistance = distance;
                 param = t;
@@ -184,6 +273,10 @@ SignedDistance CubicSegment::signedDistance(Point2 origin, double &param) const
         return SignedDistance(minDistance, fabs(dotProduct((p[3]-p[2]).normalize(), (p[3]-origin).normalize())));
 }
 
+SignedDistance CubicSegment::signedDistance(Point2 origin, double &param) const {
+    return signedDistance(p, origin, param);
+}
+
 // Original method by solving a fifth order polynomial
 /*SignedDistance CubicSegment::signedDistance(Point2 origin, double &param) const {
     Vector2 qa = p[0]-origin;
@@ -228,6 +321,336 @@ SignedDistance CubicSegment::signedDistance(Point2 origin, double &param) const
         return SignedDistance(minDistance, fabs(dotProduct((p[3]-p[2]).normalize(), (p[3]-origin).normalize())));
 }*/
 
+/*
+ * Batched versions of the above. They evaluate the exact same expressions on MSDFGEN_BATCH_SIZE origins at once,
+ * so they agree with signedDistance to the bit unless the compiler contracts one of the two into fused multiply-adds,
+ * in which case they may differ by a few ulps. Instantiated with FloatBatch and FloatVector2, they evaluate the same expressions
+ * on MSDFGEN_FLOAT_BATCH_SIZE origins entirely in single precision, from single-precision control points.
+ */
+
+template <class B>
+static void loadOrigins(const Point2 *origins, B &x, B &y) {
+    typedef typename B::Scalar Scalar;
+    Scalar ox[B::SIZE], oy[B::SIZE];
+    for (int i = 0; i < B::SIZE; ++i)
+        ox[i] = Scalar(origins[i].x), oy[i] = Scalar(origins[i].y);
+    x = B::load(ox);
+    y = B::load(oy);
+}
+
+template <class B>
+static void storeDistances(B distance, B dot, B param, SignedDistance *distances, double *params) {
+    typename B::Scalar d[B::SIZE], a[B::SIZE], t[B::SIZE];
+    distance.store(d);
+    dot.store(a);
+    param.store(t);
+    for (int i = 0; i < B::SIZE; ++i) {
+        distances[i] = SignedDistance(d[i], a[i]);
+        params[i] = t[i];
+    }
+}
+
+/// Same as Vector2::normalize.
+template <class B>
+static void normalize(B &x, B &y) {
+    B len = sqrt(x*x+y*y);
+    typename B::Mask zero = len == 0.;
+    x = select(zero, 0., x/len);
+    y = select(zero, 1., y/len);
+}
+
+/// Roots of the cubic equation solved by quadraticDistances. Missing roots are marked by values outside of (0, 1).
+/// The double-precision batches use solveCubic itself, so that they keep matching signedDistance exactly.
+static void quadraticRoots(Batch t[3], double a, double b, Batch c, Batch d) {
+    double cs[Batch::SIZE], ds[Batch::SIZE], ts[3][Batch::SIZE];
+    c.store(cs);
+    d.store(ds);
+    for (int i = 0; i < Batch::SIZE; ++i) {
+        double x[3];
+        int solutions = solveCubic(x, a, b, cs[i], ds[i]);
+        for (int j = 0; j < 3; ++j)
+            ts[j][i] = j < solutions ? x[j] : -1;
+    }
+    for (int j = 0; j < 3; ++j)
+        t[j] = Batch::load(ts[j]);
+}
+
+/// The single-precision batches solve in double precision too, because the normalized coefficients of nearly straight curves overflow a float.
+static void quadraticRoots(FloatBatch t[3], double a, double b, FloatBatch c, FloatBatch d) {
+    float cs[FloatBatch::SIZE], ds[FloatBatch::SIZE], ts[3][FloatBatch::SIZE];
+    c.store(cs);
+    d.store(ds);
+    for (int i = 0; i < FloatBatch::SIZE; ++i) {
+        double x[3];
+        int solutions = solveCubic(x, a, b, cs[i], ds[i]);
+        for (int j = 0; j < 3; ++j)
+            ts[j][i] = j < solutions ? float(x[j]) : -1.f;
+    }
+    for (int j = 0; j < 3; ++j)
+        t[j] = FloatBatch::load(ts[j]);
+}
+
+template <class B, class V>
+static void linearDistances(const V *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    typedef typename B::Mask Mask;
+    B ox, oy;
+    loadOrigins(origins, ox, oy);
+    B aqx = ox-p[0].x, aqy = oy-p[0].y;
+    V ab = p[1]-p[0];
+    B param = (aqx*ab.x+aqy*ab.y)/dotProduct(ab, ab);
+    Mask second = param > .5;
+    B eqx = select(second, B(p[1].x), B(p[0].x))-ox, eqy = select(second, B(p[1].y), B(p[0].y))-oy;
+    B endpointDistance = sqrt(eqx*eqx+eqy*eqy);
+    V orthonormal = ab.getOrthonormal(false);
+    B orthoDistance = orthonormal.x*aqx+orthonormal.y*aqy;
+    Mask ortho = (param > 0.)&(param < 1.)&(fabs(orthoDistance) < endpointDistance);
+
+    B distance = nonZeroSign(aqx*ab.y-aqy*ab.x)*endpointDistance;
+    V abn = ab.normalize();
+    normalize(eqx, eqy);
+    B dot = fabs(abn.x*eqx+abn.y*eqy);
+    storeDistances(select(ortho, orthoDistance, distance), select(ortho, 0., dot), param, distances, params);
+}
+
+template <class B, class V>
+static void quadraticDistances(const V *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    typedef typename B::Mask Mask;
+    B ox, oy;
+    loadOrigins(origins, ox, oy);
+    B qax = p[0].x-ox, qay = p[0].y-oy;
+    V ab = p[1]-p[0];
+    V br = p[0]+p[2]-p[1]-p[1];
+    double a = dotProduct(br, br);
+    double b = 3*dotProduct(ab, br);
+    B c = 2*dotProduct(ab, ab)+(qax*br.x+qay*br.y);
+    B d = qax*ab.x+qay*ab.y;
+
+    B ts[3];
+    quadraticRoots(ts, a, b, c, d);
+
+    B minDistance = nonZeroSign(ab.x*qay-ab.y*qax)*sqrt(qax*qax+qay*qay); // distance from A
+    B param = -d/dotProduct(ab, ab);
+    V bc = p[2]-p[1];
+    B cqx = p[2].x-ox, cqy = p[2].y-oy;
+    {
+        B distance = nonZeroSign(bc.x*cqy-bc.y*cqx)*sqrt(cqx*cqx+cqy*cqy); // distance from B
+        Mask closer = fabs(distance) < fabs(minDistance);
+        minDistance = select(closer, distance, minDistance);
+        param = select(closer, ((ox-p[1].x)*bc.x+(oy-p[1].y)*bc.y)/dotProduct(bc, bc), param);
+    }
+    V ac = p[2]-p[0];
+    for (int j = 0; j < 3; ++j) {
+        B t = ts[j];
+        Mask inside = (t > 0.)&(t < 1.);
+        if (!inside.bits())
+            continue;
+        B eqx = p[0].x+2*t*ab.x+t*t*br.x-ox;
+        B eqy = p[0].y+2*t*ab.y+t*t*br.y-oy;
+        B distance = nonZeroSign(ac.x*eqy-ac.y*eqx)*sqrt(eqx*eqx+eqy*eqy);
+        Mask closer = inside&(fabs(distance) <= fabs(minDistance));
+        minDistance = select(closer, distance, minDistance);
+        param = select(closer, t, param);
+    }
+
+    V abn = ab.normalize(), bcn = bc.normalize();
+    normalize(qax, qay);
+    normalize(cqx, cqy);
+    B dot = select(param < .5, fabs(abn.x*qax+abn.y*qay), fabs(bcn.x*cqx+bcn.y*cqy));
+    storeDistances(minDistance, select((param >= 0.)&(param <= 1.), 0., dot), param, distances, params);
+}
+
+template <class B, class V>
+static void cubicDistances(const V *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    typedef typename B::Mask Mask;
+    B ox, oy;
+    loadOrigins(origins, ox, oy);
+    B qax = p[0].x-ox, qay = p[0].y-oy;
+    V ab = p[1]-p[0];
+    V br = p[2]-p[1]-ab;
+    V as = (p[3]-p[2])-(p[2]-p[1])-br;
+
+    B minDistance = nonZeroSign(ab.x*qay-ab.y*qax)*sqrt(qax*qax+qay*qay); // distance from A
+    B param = -(qax*ab.x+qay*ab.y)/dotProduct(ab, ab);
+    V cd = p[3]-p[2];
+    B dqx = p[3].x-ox, dqy = p[3].y-oy;
+    {
+        B distance = nonZeroSign(cd.x*dqy-cd.y*dqx)*sqrt(dqx*dqx+dqy*dqy); // distance from B
+        Mask closer = fabs(distance) < fabs(minDistance);
+        minDistance = select(closer, distance, minDistance);
+        param = select(closer, ((ox-p[2].x)*cd.x+(oy-p[2].y)*cd.y)/dotProduct(cd, cd), param);
+    }
+    // Iterative minimum distance search, lanes drop out as their parameter leaves the curve
+    V d01 = p[1]-p[0], d12 = p[2]-p[1], d23 = p[3]-p[2];
+    for (int i = 0; i <= MSDFGEN_CUBIC_SEARCH_STARTS; ++i) {
+        B t = (double) i/MSDFGEN_CUBIC_SEARCH_STARTS;
+        Mask active = t >= 0.;
+        for (int step = 0;; ++step) {
+            B p12x = mix<B>(p[1].x, p[2].x, t), p12y = mix<B>(p[1].y, p[2].y, t);
+            B qptx = mix(mix(mix<B>(p[0].x, p[1].x, t), p12x, t), mix(p12x, mix<B>(p[2].x, p[3].x, t), t), t)-ox;
+            B qpty = mix(mix(mix<B>(p[0].y, p[1].y, t), p12y, t), mix(p12y, mix<B>(p[2].y, p[3].y, t), t), t)-oy;
+            B dirx = mix(mix<B>(d01.x, d12.x, t), mix<B>(d12.x, d23.x, t), t);
+            B diry = mix(mix<B>(d01.y, d12.y, t), mix<B>(d12.y, d23.y, t), t);
+            B distance = nonZeroSign(dirx*qpty-diry*qptx)*sqrt(qptx*qptx+qpty*qpty);
+            Mask closer = active&(fabs(distance) < fabs(minDistance));
+            minDistance = select(closer, distance, minDistance);
+            param = select(closer, t, param);
+            if (step == MSDFGEN_CUBIC_SEARCH_STEPS)
+                break;
+            // Improve t
+            B d1x = 3*as.x*t*t+6*br.x*t+3*ab.x, d1y = 3*as.y*t*t+6*br.y*t+3*ab.y;
+            B d2x = 6*as.x*t+6*br.x, d2y = 6*as.y*t+6*br.y;
+            t = t-(qptx*d1x+qpty*d1y)/((d1x*d1x+d1y*d1y)+(qptx*d2x+qpty*d2y));
+            active = andNot(active, (t < 0.)|(t > 1.));
+            if (!active.bits())
+                break;
+        }
+    }
+
+    V abn = ab.normalize(), cdn = cd.normalize();
+    normalize(qax, qay);
+    normalize(dqx, dqy);
+    B dot = select(param < .5, fabs(abn.x*qax+abn.y*qay), fabs(cdn.x*dqx+cdn.y*dqy));
+    storeDistances(minDistance, select((param >= 0.)&(param <= 1.), 0., dot), param, distances, params);
+}
+
+void LinearSegment::signedDistances(const Point2 *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    linearDistances<Batch, Vector2>(p, origins, distances, params);
+}
+
+void LinearSegment::signedDistancesFloat(const FloatPoint2 *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    linearDistances<FloatBatch, FloatVector2>(p, origins, distances, params);
+}
+
+void LinearSegment::signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const {
+    signedDistances(p, origins, distances, params);
+}
+
+void QuadraticSegment::signedDistances(const Point2 *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    quadraticDistances<Batch, Vector2>(p, origins, distances, params);
+}
+
+void QuadraticSegment::signedDistancesFloat(const FloatPoint2 *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    quadraticDistances<FloatBatch, FloatVector2>(p, origins, distances, params);
+}
+
+void QuadraticSegment::signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const {
+    signedDistances(p, origins, distances, params);
+}
+
+void CubicSegment::signedDistances(const Point2 *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    cubicDistances<Batch, Vector2>(p, origins, distances, params);
+}
+
+void CubicSegment::signedDistancesFloat(const FloatPoint2 *p, const Point2 *origins, SignedDistance *distances, double *params) {
+    cubicDistances<FloatBatch, FloatVector2>(p, origins, distances, params);
+}
+
+void CubicSegment::signedDistances(const Point2 *origins, SignedDistance *distances, double *params) const {
+    signedDistances(p, origins, distances, params);
+}
+
+/*
+ * Scanline intersections. Curves are split into pieces that are monotonic in Y, and each piece counts as crossing the line
+ * if y lies in the half-open interval between its end points, so a line passing exactly through a joint counts it once.
+ */
+
+/// Picks the root that lies within the piece from t0 to t1, or the one closest to it if rounding pushed them all out.
+static double pieceRoot(const double *roots, int solutions, double t0, double t1) {
+    double best = .5*(t0+t1), bestDistance = 1e240;
+    for (int i = 0; i < solutions; ++i) {
+        double distance = max(max(t0-roots[i], roots[i]-t1), 0.);
+        if (distance < bestDistance) {
+            best = clamp(roots[i], t0, t1);
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+int LinearSegment::scanlineIntersections(const Point2 *p, double x[3], int dy[3], double y) {
+    if ((y >= p[0].y && y < p[1].y) || (y >= p[1].y && y < p[0].y)) {
+        double param = (y-p[0].y)/(p[1].y-p[0].y);
+        x[0] = mix(p[0].x, p[1].x, param);
+        dy[0] = sign(p[1].y-p[0].y);
+        return 1;
+    }
+    return 0;
+}
+
+int LinearSegment::scanlineIntersections(double x[3], int dy[3], double y) const {
+    return scanlineIntersections(p, x, dy, y);
+}
+
+int QuadraticSegment::scanlineIntersections(const Point2 *p, double x[3], int dy[3], double y) {
+    // y(t) = a*t^2 + b*t + c
+    double a = p[0].y-2*p[1].y+p[2].y;
+    double b = 2*(p[1].y-p[0].y);
+    double c = p[0].y;
+    double ts[3] = { 0, 1, 1 };
+    int pieces = 1;
+    if (a != 0) {
+        double extremum = -b/(2*a);
+        if (extremum > 0 && extremum < 1)
+            ts[1] = extremum, pieces = 2;
+    }
+    int total = 0;
+    double y0 = p[0].y;
+    for (int i = 0; i < pieces; ++i) {
+        double y1 = i+1 == pieces ? p[2].y : point(p, ts[i+1]).y;
+        if ((y >= y0 && y < y1) || (y >= y1 && y < y0)) {
+            double roots[2];
+            int solutions = solveQuadratic(roots, a, b, c-y);
+            x[total] = point(p, pieceRoot(roots, solutions, ts[i], ts[i+1])).x;
+            dy[total] = sign(y1-y0);
+            ++total;
+        }
+        y0 = y1;
+    }
+    return total;
+}
+
+int QuadraticSegment::scanlineIntersections(double x[3], int dy[3], double y) const {
+    return scanlineIntersections(p, x, dy, y);
+}
+
+int CubicSegment::scanlineIntersections(const Point2 *p, double x[3], int dy[3], double y) {
+    // y(t) = a*t^3 + b*t^2 + c*t + d
+    double a = -p[0].y+3*p[1].y-3*p[2].y+p[3].y;
+    double b = 3*p[0].y-6*p[1].y+3*p[2].y;
+    double c = 3*(p[1].y-p[0].y);
+    double d = p[0].y;
+    double ts[4] = { 0, 1, 1, 1 };
+    int pieces = 1;
+    double extrema[2];
+    int solutions = solveQuadratic(extrema, 3*a, 2*b, c);
+    if (solutions == 2 && extrema[0] > extrema[1]) {
+        double t = extrema[0];
+        extrema[0] = extrema[1], extrema[1] = t;
+    }
+    for (int i = 0; i < solutions; ++i)
+        if (extrema[i] > ts[pieces-1] && extrema[i] < 1)
+            ts[pieces++] = extrema[i];
+    ts[pieces] = 1;
+    int total = 0;
+    double y0 = p[0].y;
+    for (int i = 0; i < pieces; ++i) {
+        double y1 = i+1 == pieces ? p[3].y : point(p, ts[i+1]).y;
+        if ((y >= y0 && y < y1) || (y >= y1 && y < y0)) {
+            double roots[3];
+            int rootCount = solveCubic(roots, a, b, c, d-y);
+            x[total] = point(p, pieceRoot(roots, rootCount, ts[i], ts[i+1])).x;
+            dy[total] = sign(y1-y0);
+            ++total;
+        }
+        y0 = y1;
+    }
+    return total;
+}
+
+int CubicSegment::scanlineIntersections(double x[3], int dy[3], double y) const {
+    return scanlineIntersections(p, x, dy, y);
+}
+
 static void pointBounds(Point2 p, double &l, double &b, double &r, double &t) {
     if (p.x < l) l = p.x;
     if (p.y < b) b = p.y;
@@ -311,24 +734,36 @@ void CubicSegment::moveEndPoint(Point2 to) {
 }
 
 void LinearSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const {
-    part1 = new LinearSegment(p[0], point(1/3.), color);
-    part2 = new LinearSegment(point(1/3.), point(2/3.), color);
-    part3 = new LinearSegment(point(2/3.), p[1], color);
+    splitInThirds(part1, part2, part3, NULL);
+}
+
+void LinearSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const {
+    part1 = new (arena) LinearSegment(p[0], point(1/3.), color);
+    part2 = new (arena) LinearSegment(point(1/3.), point(2/3.), color);
+    part3 = new (arena) LinearSegment(point(2/3.), p[1], color);
 }
 
 void QuadraticSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const {
-    part1 = new QuadraticSegment(p[0], mix(p[0], p[1], 1/3.), point(1/3.), color);
-    part2 = new QuadraticSegment(point(1/3.), mix(mix(p[0], p[1], 5/9.), mix(p[1], p[2], 4/9.), .5), point(2/3.), color);
-    part3 = new QuadraticSegment(point(2/3.), mix(p[1], p[2], 2/3.), p[2], color);
+    splitInThirds(part1, part2, part3, NULL);
+}
+
+void QuadraticSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const {
+    part1 = new (arena) QuadraticSegment(p[0], mix(p[0], p[1], 1/3.), point(1/3.), color);
+    part2 = new (arena) QuadraticSegment(point(1/3.), mix(mix(p[0], p[1], 5/9.), mix(p[1], p[2], 4/9.), .5), point(2/3.), color);
+    part3 = new (arena) QuadraticSegment(point(2/3.), mix(p[1], p[2], 2/3.), p[2], color);
 }
 
 void CubicSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3) const {
-    part1 = new CubicSegment(p[0], mix(p[0], p[1], 1/3.), mix(mix(p[0], p[1], 1/3.), mix(p[1], p[2], 1/3.), 1/3.), point(1/3.), color);
-    part2 = new CubicSegment(point(1/3.),
+    splitInThirds(part1, part2, part3, NULL);
+}
+
+void CubicSegment::splitInThirds(EdgeSegment *&part1, EdgeSegment *&part2, EdgeSegment *&part3, EdgeArena *arena) const {
+    part1 = new (arena) CubicSegment(p[0], mix(p[0], p[1], 1/3.), mix(mix(p[0], p[1], 1/3.), mix(p[1], p[2], 1/3.), 1/3.), point(1/3.), color);
+    part2 = new (arena) CubicSegment(point(1/3.),
         mix(mix(mix(p[0], p[1], 1/3.), mix(p[1], p[2], 1/3.), 1/3.), mix(mix(p[1], p[2], 1/3.), mix(p[2], p[3], 1/3.), 1/3.), 2/3.),
         mix(mix(mix(p[0], p[1], 2/3.), mix(p[1], p[2], 2/3.), 2/3.), mix(mix(p[1], p[2], 2/3.), mix(p[2], p[3], 2/3.), 2/3.), 1/3.),
         point(2/3.), color);
-    part3 = new CubicSegment(point(2/3.), mix(mix(p[1], p[2], 2/3.), mix(p[2], p[3], 2/3.), 2/3.), mix(p[2], p[3], 2/3.), p[3], color);
+    part3 = new (arena) CubicSegment(point(2/3.), mix(mix(p[1], p[2], 2/3.), mix(p[2], p[3], 2/3.), 2/3.), mix(p[2], p[3], 2/3.), p[3], color);
 }
 
 }
@@ -64,7 +64,7 @@ static int readControlPoints(T *input, Point2 *output) {
 }
 
 template <typename T, int (*readChar)(T *), int (*readCoord)(T *, Point2 &)>
-static bool readContour(T *input, Contour &output, const Point2 *first, int terminator, bool &colorsSpecified) {
+static bool readContour(T *input, Contour &output, EdgeArena *arena, const Point2 *first, int terminator, bool &colorsSpecified) {
     Point2 p[4], start;
     if (first)
         p[0] = *first;
@@ -82,7 +82,7 @@ static bool readContour(T *input, Contour &output, const Point2 *first, int term
         EdgeColor color = WHITE;
         int result = readCoord(input, p[1]);
         if (result == 2) {
-            output.addEdge(EdgeHolder(p[0], p[1], color));
+            output.addEdge(EdgeHolder(p[0], p[1], color, arena));
             p[0] = p[1];
             continue;
         } else if (result == 1)
@@ -91,7 +91,7 @@ static bool readContour(T *input, Contour &output, const Point2 *first, int term
             int controlPoints = 0;
             switch ((c = readChar(input))) {
                 case '#':
-                    output.addEdge(EdgeHolder(p[0], start, color));
+                    output.addEdge(EdgeHolder(p[0], start, color, arena));
                     p[0] = start;
                     continue;
                 case ';':
@@ -144,15 +144,15 @@ static bool readContour(T *input, Contour &output, const Point2 *first, int term
             }
             switch (controlPoints) {
                 case 0:
-                    output.addEdge(EdgeHolder(p[0], p[1], color));
+                    output.addEdge(EdgeHolder(p[0], p[1], color, arena));
                     p[0] = p[1];
                     continue;
                 case 1:
-                    output.addEdge(EdgeHolder(p[0], p[1], p[2], color));
+                    output.addEdge(EdgeHolder(p[0], p[1], p[2], color, arena));
                     p[0] = p[2];
                     continue;
                 case 2:
-                    output.addEdge(EdgeHolder(p[0], p[1], p[2], p[3], color));
+                    output.addEdge(EdgeHolder(p[0], p[1], p[2], p[3], color, arena));
                     p[0] = p[3];
                     continue;
             }
@@ -168,7 +168,7 @@ bool readShapeDescription(FILE *input, Shape &output, bool *colorsSpecified) {
     Point2 p;
     int result = readCoordF(input, p);
     if (result == 2) {
-        return readContour<FILE, readCharF, readCoordF>(input, output.addContour(), &p, EOF, locColorsSpec);
+        return readContour<FILE, readCharF, readCoordF>(input, output.addContour(), output.arena, &p, EOF, locColorsSpec);
     } else if (result == 1)
         return false;
     else {
@@ -183,7 +183,7 @@ bool readShapeDescription(FILE *input, Shape &output, bool *colorsSpecified) {
                 c = readCharF(input);
         }
         for (; c == '{'; c = readCharF(input))
-            if (!readContour<FILE, readCharF, readCoordF>(input, output.addContour(), NULL, '}', locColorsSpec))
+            if (!readContour<FILE, readCharF, readCoordF>(input, output.addContour(), output.arena, NULL, '}', locColorsSpec))
                 return false;
         if (colorsSpecified)
             *colorsSpecified = locColorsSpec;
@@ -198,7 +198,7 @@ bool readShapeDescription(const char *input, Shape &output, bool *colorsSpecifie
     Point2 p;
     int result = readCoordS(&input, p);
     if (result == 2) {
-        return readContour<const char *, readCharS, readCoordS>(&input, output.addContour(), &p, EOF, locColorsSpec);
+        return readContour<const char *, readCharS, readCoordS>(&input, output.addContour(), output.arena, &p, EOF, locColorsSpec);
     } else if (result == 1)
         return false;
     else {
@@ -212,7 +212,7 @@ bool readShapeDescription(const char *input, Shape &output, bool *colorsSpecifie
             c = readCharS(&input);
         }
         for (; c == '{'; c = readCharS(&input))
-            if (!readContour<const char *, readCharS, readCoordS>(&input, output.addContour(), NULL, '}', locColorsSpec))
+            if (!readContour<const char *, readCharS, readCoordS>(&input, output.addContour(), output.arena, NULL, '}', locColorsSpec))
                 return false;
         if (colorsSpecified)
             *colorsSpecified = locColorsSpec;
@@ -2,56 +2,271 @@
 #include "msdfgen/msdfgen.h"
 
 #include "msdfgen/core/arithmetics.hpp"
+#include "msdfgen/core/EdgeGrid.h"
 
 namespace msdfgen {
 
+/// The nearest edge found so far for one distance channel.
+struct NearestEdge {
+    SignedDistance minDistance;
+    double nearParam;
+    int nearIndex;
+
+    NearestEdge() : nearParam(0), nearIndex(-1) { }
+    /// Records the edge if it is closer. Ties go to the lowest edge index, which matches a sequential scan over the shape's edges.
+    void add(const SignedDistance &distance, double param, int index) {
+        if (distance < minDistance || (index < nearIndex && !(minDistance < distance))) {
+            minDistance = distance;
+            nearParam = param;
+            nearIndex = index;
+        }
+    }
+    /// Converts the distance to pseudo-distance, if an edge was found.
+    void toPseudoDistance(const CompiledShape &shape, Point2 p) {
+        if (nearIndex >= 0)
+            shape.distanceToPseudoDistance(nearIndex, minDistance, p, nearParam);
+    }
+    /// Returns the largest distance an edge may have and still be considered.
+    double bound() const {
+        return fabs(minDistance.distance);
+    }
+};
+
+class SingleChannelSelector {
+
+public:
+    NearestEdge nearest;
+
+    double bound(int) const {
+        return nearest.bound();
+    }
+    void add(const CompiledShape &shape, const EdgeGrid &grid, int index, const Point2 *p) {
+        if (grid.edgeDistanceBound(index, *p) > nearest.bound())
+            return;
+        double param;
+        SignedDistance distance = shape.signedDistance(index, *p, param);
+        nearest.add(distance, param, index);
+    }
+
+};
+
+class MultiChannelSelector {
+
+public:
+    NearestEdge r, g, b;
+
+    double bound(int) const {
+        return max(r.bound(), max(g.bound(), b.bound()));
+    }
+    void add(const CompiledShape &shape, const EdgeGrid &grid, int index, const Point2 *p) {
+        EdgeColor color = shape.edgeColors[index];
+        double distanceBound = grid.edgeDistanceBound(index, *p);
+        if (!((color&RED && distanceBound <= r.bound())
+            || (color&GREEN && distanceBound <= g.bound())
+            || (color&BLUE && distanceBound <= b.bound())))
+            return;
+        double param;
+        SignedDistance distance = shape.signedDistance(index, *p, param);
+        if (color&RED)
+            r.add(distance, param, index);
+        if (color&GREEN)
+            g.add(distance, param, index);
+        if (color&BLUE)
+            b.add(distance, param, index);
+    }
+
+};
+
+/// Single-channel selector for a batch of MSDFGEN_BATCH_SIZE points, which evaluates an edge for all of them at once if any of them needs it.
+/// Double precision only: at corners, where two edges are equally near, rounding may pick the other edge, whose pseudo-distance can have the opposite sign.
+/// The median of a multi-channel field hides that, a single channel does not.
+class SingleChannelBatchSelector {
+
+public:
+    enum { SIZE = MSDFGEN_BATCH_SIZE };
+    typedef float Pixel;
+
+    NearestEdge nearest[SIZE];
+
+    double bound(int i) const {
+        return nearest[i].bound();
+    }
+    void add(const CompiledShape &shape, const EdgeGrid &grid, int index, const Point2 *p) {
+        bool needed = false;
+        for (int i = 0; i < SIZE && !needed; ++i)
+            needed = grid.edgeDistanceBound(index, p[i]) <= nearest[i].bound();
+        if (!needed)
+            return;
+        SignedDistance distances[SIZE];
+        double params[SIZE];
+        shape.signedDistances(index, p, distances, params);
+        for (int i = 0; i < SIZE; ++i)
+            nearest[i].add(distances[i], params[i], index);
+    }
+    /// Writes the pseudo-distance of point i, multiplied by sign and scaled to the output range.
+    void write(const CompiledShape &shape, int i, Point2 p, double range, double sign, float &pixel) {
+        nearest[i].toPseudoDistance(shape, p);
+        pixel = float(sign*nearest[i].minDistance.distance/range+.5);
+    }
+    static void fill(float &pixel, float value) {
+        pixel = value;
+    }
+
+};
+
+/// Multi-channel selector for a batch of points, which evaluates an edge for all of them at once if any of them needs it.
+/// The batch holds MSDFGEN_BATCH_SIZE points in double precision or MSDFGEN_FLOAT_BATCH_SIZE points in single precision.
+template <Precision precision>
+class MultiChannelBatchSelector {
+
+public:
+    enum { SIZE = precision == SINGLE_PRECISION ? MSDFGEN_FLOAT_BATCH_SIZE : MSDFGEN_BATCH_SIZE };
+    typedef FloatRGB Pixel;
+
+    NearestEdge r[SIZE], g[SIZE], b[SIZE];
+
+    double bound(int i) const {
+        return max(r[i].bound(), max(g[i].bound(), b[i].bound()));
+    }
+    void add(const CompiledShape &shape, const EdgeGrid &grid, int index, const Point2 *p) {
+        EdgeColor color = shape.edgeColors[index];
+        bool needed = false;
+        for (int i = 0; i < SIZE && !needed; ++i) {
+            double distanceBound = grid.edgeDistanceBound(index, p[i]);
+            needed = (color&RED && distanceBound <= r[i].bound())
+                || (color&GREEN && distanceBound <= g[i].bound())
+                || (color&BLUE && distanceBound <= b[i].bound());
+        }
+        if (!needed)
+            return;
+        SignedDistance distances[SIZE];
+        double params[SIZE];
+        if (precision == SINGLE_PRECISION)
+            shape.signedDistancesFloat(index, p, distances, params);
+        else
+            shape.signedDistances(index, p, distances, params);
+        // Points that didn't need the edge can take it too, it can only be a true improvement
+        for (int i = 0; i < SIZE; ++i) {
+            if (color&RED)
+                r[i].add(distances[i], params[i], index);
+            if (color&GREEN)
+                g[i].add(distances[i], params[i], index);
+            if (color&BLUE)
+                b[i].add(distances[i], params[i], index);
+        }
+    }
+    /// Writes the pseudo-distances of point i, multiplied by sign and scaled to the output range.
+    void write(const CompiledShape &shape, int i, Point2 p, double range, double sign, FloatRGB &pixel) {
+        r[i].toPseudoDistance(shape, p);
+        g[i].toPseudoDistance(shape, p);
+        b[i].toPseudoDistance(shape, p);
+        pixel.r = float(sign*r[i].minDistance.distance/range+.5);
+        pixel.g = float(sign*g[i].minDistance.distance/range+.5);
+        pixel.b = float(sign*b[i].minDistance.distance/range+.5);
+    }
+    static void fill(FloatRGB &pixel, float value) {
+        pixel.r = value;
+        pixel.g = value;
+        pixel.b = value;
+    }
+
+};
+
+template <class EdgeSelector>
+static void visitCell(const CompiledShape &shape, const EdgeGrid &grid, int column, int row, const Point2 *p, EdgeSelector &selector, std::vector<unsigned> &visited, unsigned stamp) {
+    const std::vector<int> &cellEdges = grid.cellEdges();
+    int begin, end;
+    grid.cellRange(column, row, begin, end);
+    for (int i = begin; i < end; ++i) {
+        int index = cellEdges[i];
+        if (visited[index] == stamp)
+            continue;
+        visited[index] = stamp;
+        selector.add(shape, grid, index, p);
+    }
+}
+
+/// Feeds the selector with the edges around the points p[0] to p[count-1], ring of cells by ring of cells, until no remaining edge can be closer to any of the points than selector.bound(i).
+template <class EdgeSelector>
+static void findNearestEdges(const CompiledShape &shape, const EdgeGrid &grid, const Point2 *p, int count, EdgeSelector &selector, std::vector<unsigned> &visited, unsigned stamp) {
+    // Block of cells containing all the points
+    int bc0, br0, bc1, br1;
+    grid.cell(p[0], bc0, br0);
+    bc1 = bc0, br1 = br0;
+    for (int i = 1; i < count; ++i) {
+        int column, row;
+        grid.cell(p[i], column, row);
+        bc0 = min(bc0, column), bc1 = max(bc1, column);
+        br0 = min(br0, row), br1 = max(br1, row);
+    }
+    int columns = grid.columns(), rows = grid.rows();
+    // Previously visited block, initially empty
+    int pc0 = 0, pr0 = 0, pc1 = -1, pr1 = -1;
+    for (int ring = 0;; ++ring) {
+        int c0 = max(bc0-ring, 0), c1 = min(bc1+ring, columns-1);
+        int r0 = max(br0-ring, 0), r1 = min(br1+ring, rows-1);
+        for (int row = r0; row <= r1; ++row) {
+            for (int column = c0; column <= c1; ++column) {
+                if (row >= pr0 && row <= pr1 && column >= pc0 && column <= pc1) {
+                    column = pc1;
+                    continue;
+                }
+                visitCell(shape, grid, column, row, p, selector, visited, stamp);
+            }
+        }
+        if (c0 == 0 && r0 == 0 && c1 == columns-1 && r1 == rows-1)
+            break;
+        bool done = true;
+        for (int i = 0; i < count && done; ++i)
+            done = grid.outsideDistanceBound(p[i], c0, r0, c1, r1) > selector.bound(i);
+        if (done)
+            break;
+        pc0 = c0, pr0 = r0, pc1 = c1, pr1 = r1;
+    }
+}
+
 void generateSDF(Bitmap<float> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate) {
+    generateSDF(output, CompiledShape(shape), range, scale, translate);
+}
+
+void generateSDF(Bitmap<float> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate) {
     int w = output.width(), h = output.height();
+    EdgeGrid grid(shape);
 #ifdef MSDFGEN_USE_OPENMP
     #pragma omp parallel for
 #endif
     for (int y = 0; y < h; ++y) {
         int row = shape.inverseYAxis ? h-y-1 : y;
+        std::vector<unsigned> visited(grid.edgeCount(), 0);
         for (int x = 0; x < w; ++x) {
-            double dummy;
             Point2 p = Vector2(x+.5, y+.5)/scale-translate;
-            SignedDistance minDistance;
-            for (std::vector<Contour>::const_iterator contour = shape.contours.begin(); contour != shape.contours.end(); ++contour)
-                for (std::vector<EdgeHolder>::const_iterator edge = contour->edges.begin(); edge != contour->edges.end(); ++edge) {
-                    SignedDistance distance = (*edge)->signedDistance(p, dummy);
-                    if (distance < minDistance)
-                        minDistance = distance;
-                }
-            output(x, row) = float(minDistance.distance/range+.5);
+            SingleChannelSelector selector;
+            findNearestEdges(shape, grid, &p, 1, selector, visited, x+1);
+            output(x, row) = float(selector.nearest.minDistance.distance/range+.5);
         }
     }
 }
 
 void generatePseudoSDF(Bitmap<float> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate) {
+    generatePseudoSDF(output, CompiledShape(shape), range, scale, translate);
+}
+
+void generatePseudoSDF(Bitmap<float> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate) {
     int w = output.width(), h = output.height();
+    EdgeGrid grid(shape);
 #ifdef MSDFGEN_USE_OPENMP
     #pragma omp parallel for
 #endif
     for (int y = 0; y < h; ++y) {
         int row = shape.inverseYAxis ? h-y-1 : y;
+        std::vector<unsigned> visited(grid.edgeCount(), 0);
         for (int x = 0; x < w; ++x) {
             Point2 p = Vector2(x+.5, y+.5)/scale-translate;
-            SignedDistance minDistance;
-            const EdgeHolder *nearEdge = NULL;
-            double nearParam = 0;
-            for (std::vector<Contour>::const_iterator contour = shape.contours.begin(); contour != shape.contours.end(); ++contour)
-                for (std::vector<EdgeHolder>::const_iterator edge = contour->edges.begin(); edge != contour->edges.end(); ++edge) {
-                    double param;
-                    SignedDistance distance = (*edge)->signedDistance(p, param);
-                    if (distance < minDistance) {
-                        minDistance = distance;
-                        nearEdge = &*edge;
-                        nearParam = param;
-                    }
-                }
-            if (nearEdge)
-                (*nearEdge)->distanceToPseudoDistance(minDistance, p, nearParam);
-            output(x, row) = float(minDistance.distance/range+.5);
+            SingleChannelSelector selector;
+            findNearestEdges(shape, grid, &p, 1, selector, visited, x+1);
+            NearestEdge &nearest = selector.nearest;
+            nearest.toPseudoDistance(shape, p);
+            output(x, row) = float(nearest.minDistance.distance/range+.5);
         }
     }
 }
@@ -90,15 +305,20 @@ static inline bool pixelClash(const FloatRGB &a, const FloatRGB &b, double thres
         && fabsf(ac-.5f) >= fabsf(bc-.5f); // Out of the pair, only flag the pixel farther from a shape edge
 }
 
+/// Returns whether pixel x of a row of width w clashes with one of its neighbors. prev and next are the adjacent rows, NULL at the border.
+static bool pixelClashes(const FloatRGB *row, const FloatRGB *prev, const FloatRGB *next, int x, int w, const Vector2 &threshold) {
+    return (x > 0 && pixelClash(row[x], row[x-1], threshold.x))
+        || (x < w-1 && pixelClash(row[x], row[x+1], threshold.x))
+        || (prev && pixelClash(row[x], prev[x], threshold.y))
+        || (next && pixelClash(row[x], next[x], threshold.y));
+}
+
 void msdfErrorCorrection(Bitmap<FloatRGB> &output, const Vector2 &threshold) {
     std::vector<std::pair<int, int> > clashes;
     int w = output.width(), h = output.height();
     for (int y = 0; y < h; ++y)
         for (int x = 0; x < w; ++x) {
-            if ((x > 0 && pixelClash(output(x, y), output(x-1, y), threshold.x))
-                || (x < w-1 && pixelClash(output(x, y), output(x+1, y), threshold.x))
-                || (y > 0 && pixelClash(output(x, y), output(x, y-1), threshold.y))
-                || (y < h-1 && pixelClash(output(x, y), output(x, y+1), threshold.y)))
+            if (pixelClashes(&output(0, y), y > 0 ? &output(0, y-1) : NULL, y < h-1 ? &output(0, y+1) : NULL, x, w, threshold))
                 clashes.push_back(std::make_pair(x, y));
         }
     for (std::vector<std::pair<int, int> >::const_iterator clash = clashes.begin(); clash != clashes.end(); ++clash) {
@@ -108,59 +328,196 @@ void msdfErrorCorrection(Bitmap<FloatRGB> &output, const Vector2 &threshold) {
     }
 }
 
-void generateMSDF(Bitmap<FloatRGB> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold) {
+/// Marks the pixels of row y that may lie within band of an edge, judging by the edges' bounding boxes.
+static void markNearPixels(std::vector<char> &near, const CompiledShape &shape, double band, const Vector2 &scale, const Vector2 &translate, int y) {
+    int w = int(near.size());
+    double py = (y+.5)/scale.y-translate.y;
+    near.assign(w, 0);
+    for (std::vector<CompiledShape::Bounds>::const_iterator eb = shape.edgeBounds.begin(); eb != shape.edgeBounds.end(); ++eb) {
+        double dy = max(max(eb->b-py, py-eb->t), 0.);
+        if (dy > band)
+            continue;
+        double dx = sqrt(band*band-dy*dy);
+        // Widened by a pixel on each side so that rounding can never leave out a near pixel
+        int x0 = max(int(floor((eb->l-dx+translate.x)*scale.x-.5))-1, 0);
+        int x1 = min(int(ceil((eb->r+dx+translate.x)*scale.x-.5))+1, w-1);
+        for (int x = x0; x <= x1; ++x)
+            near[x] = 1;
+    }
+}
+
+/// Returns the sign of the distance on the outside of the shape, -1 if it has no edges.
+/// It is taken from the leftmost edge crossing a scanline, whose outer side is its left side, where distances are negative if the edge goes up.
+static int outsideSign(const CompiledShape &shape) {
+    for (int edge = 0; edge < shape.edgeCount(); ++edge) {
+        const CompiledShape::Bounds &eb = shape.edgeBounds[edge];
+        if (!(eb.t > eb.b))
+            continue;
+        // The edge crosses the scanline through the middle of its bounds, so it has at least one intersection
+        double y = .5*(eb.b+eb.t);
+        double leftX = 1e240;
+        int leftDirection = 0;
+        for (int other = 0; other < shape.edgeCount(); ++other) {
+            double x[3];
+            int dy[3];
+            int n = shape.scanlineIntersections(other, x, dy, y);
+            for (int i = 0; i < n; ++i)
+                if (x[i] < leftX)
+                    leftX = x[i], leftDirection = dy[i];
+        }
+        if (leftDirection)
+            return -leftDirection;
+    }
+    return -1;
+}
+
+/// Computes the rows of a distance field one at a time, with one or three channels depending on the batch selector.
+template <class Selector>
+class DistanceRowGenerator {
+
+public:
+    typedef typename Selector::Pixel Pixel;
+
+    DistanceRowGenerator(const CompiledShape &shape, int width, double range, const Vector2 &scale, const Vector2 &translate, bool rangeLimited, bool invert) :
+        shape(shape), grid(shape), width(width), range(range), sign(invert ? -1 : 1), scale(scale), translate(translate), rangeLimited(rangeLimited) {
+        // Pixels farther than half the range from every edge saturate to these values
+        outsideValue = 0, insideValue = 1;
+        if (rangeLimited && outsideSign(shape)*sign > 0)
+            outsideValue = 1, insideValue = 0;
+    }
+
+    /// Writes the pixels of row y, counted from the bottom, to output.
+    void operator()(Pixel *output, int y) const {
+        const int batchSize = Selector::SIZE;
+        int w = width;
+        std::vector<unsigned> visited(grid.edgeCount(), 0);
+        std::vector<char> near(w, 1);
+        Scanline line;
+        if (rangeLimited) {
+            markNearPixels(near, shape, .5*range, scale, translate, y);
+            shape.scanline(line, (y+.5)/scale.y-translate.y);
+        }
+        unsigned stamp = 0;
+        for (int x0 = 0; x0 < w;) {
+            if (!near[x0]) {
+                float value = line.filled((x0+.5)/scale.x-translate.x) ? insideValue : outsideValue;
+                Selector::fill(output[x0], value);
+                ++x0;
+                continue;
+            }
+            // A batch covers a run of near pixels, repeating its final pixel to fill up the lanes
+            int count = 1;
+            while (count < batchSize && x0+count < w && near[x0+count])
+                ++count;
+            Point2 p[batchSize];
+            for (int i = 0; i < batchSize; ++i)
+                p[i] = Vector2(x0+min(i, count-1)+.5, y+.5)/scale-translate;
+            Selector selector;
+            findNearestEdges(shape, grid, p, count, selector, visited, ++stamp);
+
+            for (int i = 0; i < count; ++i)
+                selector.write(shape, i, p[i], range, sign, output[x0+i]);
+            x0 += count;
+        }
+    }
+
+private:
+    const CompiledShape &shape;
+    EdgeGrid grid;
+    int width;
+    double range, sign;
+    Vector2 scale, translate;
+    bool rangeLimited;
+    float outsideValue, insideValue;
+
+};
+
+template <Precision precision>
+static void generateMSDFDistances(Bitmap<FloatRGB> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, bool rangeLimited) {
     int w = output.width(), h = output.height();
+    DistanceRowGenerator<MultiChannelBatchSelector<precision> > generator(shape, w, range, scale, translate, rangeLimited, false);
 #ifdef MSDFGEN_USE_OPENMP
     #pragma omp parallel for
 #endif
     for (int y = 0; y < h; ++y) {
         int row = shape.inverseYAxis ? h-y-1 : y;
-        for (int x = 0; x < w; ++x) {
-            Point2 p = Vector2(x+.5, y+.5)/scale-translate;
+        generator(&output(0, row), y);
+    }
+}
 
-            struct {
-                SignedDistance minDistance;
-                const EdgeHolder *nearEdge;
-                double nearParam;
-            } r, g, b;
-            r.nearEdge = g.nearEdge = b.nearEdge = NULL;
-            r.nearParam = g.nearParam = b.nearParam = 0;
-
-            for (std::vector<Contour>::const_iterator contour = shape.contours.begin(); contour != shape.contours.end(); ++contour)
-                for (std::vector<EdgeHolder>::const_iterator edge = contour->edges.begin(); edge != contour->edges.end(); ++edge) {
-                    double param;
-                    SignedDistance distance = (*edge)->signedDistance(p, param);
-                    if ((*edge)->color&RED && distance < r.minDistance) {
-                        r.minDistance = distance;
-                        r.nearEdge = &*edge;
-                        r.nearParam = param;
-                    }
-                    if ((*edge)->color&GREEN && distance < g.minDistance) {
-                        g.minDistance = distance;
-                        g.nearEdge = &*edge;
-                        g.nearParam = param;
-                    }
-                    if ((*edge)->color&BLUE && distance < b.minDistance) {
-                        b.minDistance = distance;
-                        b.nearEdge = &*edge;
-                        b.nearParam = param;
-                    }
-                }
+/// Converts a distance field value to a byte, saturating at the ends of the range.
+static inline unsigned char pixelFloatToByte(float value) {
+    return (unsigned char) clamp(int(value*255.f+.5f), 0, 255);
+}
 
-            if (r.nearEdge)
-                (*r.nearEdge)->distanceToPseudoDistance(r.minDistance, p, r.nearParam);
-            if (g.nearEdge)
-                (*g.nearEdge)->distanceToPseudoDistance(g.minDistance, p, g.nearParam);
-            if (b.nearEdge)
-                (*b.nearEdge)->distanceToPseudoDistance(b.minDistance, p, b.nearParam);
-            output(x, row).r = float(r.minDistance.distance/range+.5);
-            output(x, row).g = float(g.minDistance.distance/range+.5);
-            output(x, row).b = float(b.minDistance.distance/range+.5);
+template <Precision precision>
+static void generateMSDFBytes(unsigned char *output, int width, int height, int pixelStride, int rowStride, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold, bool rangeLimited, bool invert) {
+    DistanceRowGenerator<MultiChannelBatchSelector<precision> > generator(shape, width, range, scale, translate, rangeLimited, invert);
+    Vector2 threshold = edgeThreshold/(scale*range);
+    // Error correction compares each row to its neighbors, so three rows are kept in floating point
+    std::vector<FloatRGB> window(3*width);
+    for (int row = 0; row <= height; ++row) {
+        if (row < height)
+            generator(&window[row%3*width], shape.inverseYAxis ? height-row-1 : row);
+        if (row == 0)
+            continue;
+        // Row row-1 has both of its neighbors now
+        int done = row-1;
+        const FloatRGB *pixels = &window[done%3*width];
+        const FloatRGB *prev = done > 0 ? &window[(done-1)%3*width] : NULL;
+        const FloatRGB *next = row < height ? &window[row%3*width] : NULL;
+        unsigned char *dst = output+done*rowStride;
+        for (int x = 0; x < width; ++x, dst += pixelStride) {
+            FloatRGB pixel = pixels[x];
+            if (edgeThreshold > 0 && pixelClashes(pixels, prev, next, x, width, threshold)) {
+                float med = median(pixel.r, pixel.g, pixel.b);
+                pixel.r = med, pixel.g = med, pixel.b = med;
+            }
+            dst[0] = pixelFloatToByte(pixel.r);
+            dst[1] = pixelFloatToByte(pixel.g);
+            dst[2] = pixelFloatToByte(pixel.b);
         }
     }
+}
+
+void generatePseudoSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, bool rangeLimited, bool invert) {
+    generatePseudoSDF(output, width, height, pixelStride, rowStride, CompiledShape(shape), range, scale, translate, rangeLimited, invert);
+}
+
+void generatePseudoSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, bool rangeLimited, bool invert) {
+    DistanceRowGenerator<SingleChannelBatchSelector> generator(shape, width, range, scale, translate, rangeLimited, invert);
+    std::vector<float> pixels(width);
+    for (int row = 0; row < height; ++row) {
+        generator(&pixels[0], shape.inverseYAxis ? height-row-1 : row);
+        unsigned char *dst = output+row*rowStride;
+        for (int x = 0; x < width; ++x, dst += pixelStride)
+            *dst = pixelFloatToByte(pixels[x]);
+    }
+}
+
+void generateMSDF(Bitmap<FloatRGB> &output, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold, Precision precision, bool rangeLimited) {
+    generateMSDF(output, CompiledShape(shape), range, scale, translate, edgeThreshold, precision, rangeLimited);
+}
+
+void generateMSDF(Bitmap<FloatRGB> &output, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold, Precision precision, bool rangeLimited) {
+    if (precision == SINGLE_PRECISION)
+        generateMSDFDistances<SINGLE_PRECISION>(output, shape, range, scale, translate, rangeLimited);
+    else
+        generateMSDFDistances<DOUBLE_PRECISION>(output, shape, range, scale, translate, rangeLimited);
 
     if (edgeThreshold > 0)
         msdfErrorCorrection(output, edgeThreshold/(scale*range));
 }
 
+void generateMSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const Shape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold, Precision precision, bool rangeLimited, bool invert) {
+    generateMSDF(output, width, height, pixelStride, rowStride, CompiledShape(shape), range, scale, translate, edgeThreshold, precision, rangeLimited, invert);
+}
+
+void generateMSDF(unsigned char *output, int width, int height, int pixelStride, int rowStride, const CompiledShape &shape, double range, const Vector2 &scale, const Vector2 &translate, double edgeThreshold, Precision precision, bool rangeLimited, bool invert) {
+    if (precision == SINGLE_PRECISION)
+        generateMSDFBytes<SINGLE_PRECISION>(output, width, height, pixelStride, rowStride, shape, range, scale, translate, edgeThreshold, rangeLimited, invert);
+    else
+        generateMSDFBytes<DOUBLE_PRECISION>(output, width, height, pixelStride, rowStride, shape, range, scale, translate, edgeThreshold, rangeLimited, invert);
+}
+
 }
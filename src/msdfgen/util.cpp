@@ -90,7 +90,7 @@ bool loadGlyph(Shape &output, FT_Face face, unsigned int glyphIndex, double *adv
                     break;
                 case PATH_POINT:
                     if (pointType == PATH_POINT) {
-                        contour.addEdge(new LinearSegment(startPoint, point));
+                        contour.addEdge(EdgeHolder(startPoint, point, WHITE, output.arena));
                         startPoint = point;
                     } else {
                         controlPoint[0] = point;
@@ -100,12 +100,12 @@ bool loadGlyph(Shape &output, FT_Face face, unsigned int glyphIndex, double *adv
                 case QUADRATIC_POINT:
                     REQUIRE(pointType != CUBIC_POINT);
                     if (pointType == PATH_POINT) {
-                        contour.addEdge(new QuadraticSegment(startPoint, controlPoint[0], point));
+                        contour.addEdge(EdgeHolder(startPoint, controlPoint[0], point, WHITE, output.arena));
                         startPoint = point;
                         state = PATH_POINT;
                     } else {
                         Point2 midPoint = .5*controlPoint[0]+.5*point;
-                        contour.addEdge(new QuadraticSegment(startPoint, controlPoint[0], midPoint));
+                        contour.addEdge(EdgeHolder(startPoint, controlPoint[0], midPoint, WHITE, output.arena));
                         startPoint = midPoint;
                         controlPoint[0] = point;
 
@@ -119,11 +119,11 @@ bool loadGlyph(Shape &output, FT_Face face, unsigned int glyphIndex, double *adv
                 case CUBIC_POINT2:
                     REQUIRE(pointType != QUADRATIC_POINT);
                     if (pointType == PATH_POINT) {
-                        contour.addEdge(new CubicSegment(startPoint, controlPoint[0], controlPoint[1], point));
+                        contour.addEdge(EdgeHolder(startPoint, controlPoint[0], controlPoint[1], point, WHITE, output.arena));
                         startPoint = point;
                     } else {
                         Point2 midPoint = .5*controlPoint[1]+.5*point;
-                        contour.addEdge(new CubicSegment(startPoint, controlPoint[0], controlPoint[1], midPoint));
+                        contour.addEdge(EdgeHolder(startPoint, controlPoint[0], controlPoint[1], midPoint, WHITE, output.arena));
                         startPoint = midPoint;
                         controlPoint[0] = point;
                     }